@@ -0,0 +1,827 @@
+// Scanline spans of the shift indicator ring, center 120,120, radius 95..120. Generated by "make arc-spans" in the host folder,
+// see host/ArcSpanGenerator.h
+//
+// The spans of degree d are ArcSpans[ArcSpanStart[d]] up to ArcSpans[ArcSpanStart[d + 1]]. They are the pixels that are lit when
+// the bars end beyond d degrees, but not when they end at d degrees, where 0 is the bottom and 180 the top of the display
+
+#ifndef _ARC_SPANS
+#define _ARC_SPANS
+
+struct ArcSpan
+{
+  uint8_t Y;
+  uint8_t X;
+  uint8_t Length;
+};
+
+const int16_t ArcSpansCenterX = 120;   // Spans left of this are part of the left bar
+const int16_t ArcSpansCenterY = 120;
+const int16_t ArcSpansInnerRadius = 95;
+const int32_t ArcSpanDegrees = 180;
+const int32_t NumArcSpans = 6272;
+
+const uint16_t ArcSpanStart[ArcSpanDegrees + 1] = {
+      0,    50,   100,   150,   200,   250,   300,   352,   404,   456,   506,   558,
+    610,   660,   712,   762,   814,   864,   914,   964,  1014,  1062,  1112,  1160,
+   1208,  1258,  1306,  1354,  1402,  1450,  1498,  1542,  1588,  1634,  1678,  1722,
+   1766,  1810,  1852,  1894,  1936,  1976,  2016,  2056,  2094,  2132,  2172,  2210,
+   2248,  2284,  2318,  2354,  2388,  2422,  2456,  2488,  2518,  2550,  2580,  2610,
+   2638,  2666,  2694,  2720,  2746,  2770,  2794,  2818,  2840,  2860,  2880,  2902,
+   2922,  2942,  2960,  2976,  2994,  3008,  3024,  3036,  3048,  3060,  3070,  3080,
+   3090,  3098,  3106,  3114,  3120,  3126,  3131,  3136,  3142,  3148,  3156,  3164,
+   3172,  3182,  3192,  3202,  3214,  3226,  3238,  3254,  3268,  3286,  3302,  3320,
+   3340,  3360,  3382,  3402,  3422,  3444,  3468,  3492,  3516,  3542,  3568,  3596,
+   3624,  3652,  3682,  3712,  3744,  3774,  3806,  3840,  3874,  3908,  3944,  3978,
+   4014,  4052,  4090,  4128,  4168,  4206,  4246,  4286,  4326,  4368,  4410,  4452,
+   4496,  4540,  4584,  4628,  4674,  4720,  4764,  4812,  4860,  4908,  4956,  5004,
+   5054,  5102,  5150,  5200,  5248,  5298,  5348,  5398,  5448,  5500,  5550,  5602,
+   5652,  5704,  5756,  5806,  5858,  5910,  5962,  6012,  6064,  6116,  6168,  6220,
+   6272 };
+
+const ArcSpan ArcSpans[NumArcSpans] = {
+  { 215, 119,  1 }, { 215, 120,  2 }, { 216, 119,  1 }, { 216, 120,  2 }, { 217, 119,  1 }, { 217, 120,  2 }, { 218, 119,  1 }, { 218, 120,  2 },
+  { 219, 119,  1 }, { 219, 120,  2 }, { 220, 119,  1 }, { 220, 120,  2 }, { 221, 119,  1 }, { 221, 120,  2 }, { 222, 119,  1 }, { 222, 120,  2 },
+  { 223, 119,  1 }, { 223, 120,  2 }, { 224, 119,  1 }, { 224, 120,  2 }, { 225, 119,  1 }, { 225, 120,  2 }, { 226, 119,  1 }, { 226, 120,  2 },
+  { 227, 119,  1 }, { 227, 120,  2 }, { 228, 119,  1 }, { 228, 120,  2 }, { 229, 119,  1 }, { 229, 120,  2 }, { 230, 119,  1 }, { 230, 120,  2 },
+  { 231, 119,  1 }, { 231, 120,  2 }, { 232, 119,  1 }, { 232, 120,  2 }, { 233, 119,  1 }, { 233, 120,  2 }, { 234, 119,  1 }, { 234, 120,  2 },
+  { 235, 118,  2 }, { 235, 120,  3 }, { 236, 118,  2 }, { 236, 120,  3 }, { 237, 118,  2 }, { 237, 120,  3 }, { 238, 118,  2 }, { 238, 120,  3 },
+  { 239, 118,  2 }, { 239, 120,  3 }, { 215, 117,  2 }, { 215, 122,  2 }, { 216, 117,  2 }, { 216, 122,  2 }, { 217, 117,  2 }, { 217, 122,  2 },
+  { 218, 117,  2 }, { 218, 122,  2 }, { 219, 117,  2 }, { 219, 122,  2 }, { 220, 117,  2 }, { 220, 122,  2 }, { 221, 117,  2 }, { 221, 122,  2 },
+  { 222, 117,  2 }, { 222, 122,  2 }, { 223, 117,  2 }, { 223, 122,  2 }, { 224, 117,  2 }, { 224, 122,  2 }, { 225, 117,  2 }, { 225, 122,  2 },
+  { 226, 117,  2 }, { 226, 122,  2 }, { 227, 117,  2 }, { 227, 122,  2 }, { 228, 117,  2 }, { 228, 122,  2 }, { 229, 117,  2 }, { 229, 122,  2 },
+  { 230, 117,  2 }, { 230, 122,  2 }, { 231, 117,  2 }, { 231, 122,  2 }, { 232, 117,  2 }, { 232, 122,  2 }, { 233, 117,  2 }, { 233, 122,  2 },
+  { 234, 117,  2 }, { 234, 122,  2 }, { 235, 116,  2 }, { 235, 123,  2 }, { 236, 116,  2 }, { 236, 123,  2 }, { 237, 116,  2 }, { 237, 123,  2 },
+  { 238, 116,  2 }, { 238, 123,  2 }, { 239, 116,  2 }, { 239, 123,  2 }, { 215, 116,  1 }, { 215, 124,  1 }, { 216, 115,  2 }, { 216, 124,  2 },
+  { 217, 115,  2 }, { 217, 124,  2 }, { 218, 115,  2 }, { 218, 124,  2 }, { 219, 115,  2 }, { 219, 124,  2 }, { 220, 115,  2 }, { 220, 124,  2 },
+  { 221, 115,  2 }, { 221, 124,  2 }, { 222, 115,  2 }, { 222, 124,  2 }, { 223, 115,  2 }, { 223, 124,  2 }, { 224, 115,  2 }, { 224, 124,  2 },
+  { 225, 115,  2 }, { 225, 124,  2 }, { 226, 115,  2 }, { 226, 124,  2 }, { 227, 115,  2 }, { 227, 124,  2 }, { 228, 115,  2 }, { 228, 124,  2 },
+  { 229, 115,  2 }, { 229, 124,  2 }, { 230, 115,  2 }, { 230, 124,  2 }, { 231, 115,  2 }, { 231, 124,  2 }, { 232, 115,  2 }, { 232, 124,  2 },
+  { 233, 115,  2 }, { 233, 124,  2 }, { 234, 115,  2 }, { 234, 124,  2 }, { 235, 114,  2 }, { 235, 125,  2 }, { 236, 114,  2 }, { 236, 125,  2 },
+  { 237, 114,  2 }, { 237, 125,  2 }, { 238, 114,  2 }, { 238, 125,  2 }, { 239, 114,  2 }, { 239, 125,  2 }, { 215, 114,  2 }, { 215, 125,  2 },
+  { 216, 114,  1 }, { 216, 126,  1 }, { 217, 114,  1 }, { 217, 126,  1 }, { 218, 114,  1 }, { 218, 126,  1 }, { 219, 114,  1 }, { 219, 126,  1 },
+  { 220, 114,  1 }, { 220, 126,  1 }, { 221, 113,  2 }, { 221, 126,  2 }, { 222, 113,  2 }, { 222, 126,  2 }, { 223, 113,  2 }, { 223, 126,  2 },
+  { 224, 113,  2 }, { 224, 126,  2 }, { 225, 113,  2 }, { 225, 126,  2 }, { 226, 113,  2 }, { 226, 126,  2 }, { 227, 113,  2 }, { 227, 126,  2 },
+  { 228, 113,  2 }, { 228, 126,  2 }, { 229, 113,  2 }, { 229, 126,  2 }, { 230, 113,  2 }, { 230, 126,  2 }, { 231, 113,  2 }, { 231, 126,  2 },
+  { 232, 113,  2 }, { 232, 126,  2 }, { 233, 113,  2 }, { 233, 126,  2 }, { 234, 113,  2 }, { 234, 126,  2 }, { 235, 112,  2 }, { 235, 127,  2 },
+  { 236, 112,  2 }, { 236, 127,  2 }, { 237, 112,  2 }, { 237, 127,  2 }, { 238, 112,  2 }, { 238, 127,  2 }, { 239, 112,  2 }, { 239, 127,  2 },
+  { 215, 112,  2 }, { 215, 127,  2 }, { 216, 112,  2 }, { 216, 127,  2 }, { 217, 112,  2 }, { 217, 127,  2 }, { 218, 112,  2 }, { 218, 127,  2 },
+  { 219, 112,  2 }, { 219, 127,  2 }, { 220, 112,  2 }, { 220, 127,  2 }, { 221, 112,  1 }, { 221, 128,  1 }, { 222, 112,  1 }, { 222, 128,  1 },
+  { 223, 111,  2 }, { 223, 128,  2 }, { 224, 111,  2 }, { 224, 128,  2 }, { 225, 111,  2 }, { 225, 128,  2 }, { 226, 111,  2 }, { 226, 128,  2 },
+  { 227, 111,  2 }, { 227, 128,  2 }, { 228, 111,  2 }, { 228, 128,  2 }, { 229, 111,  2 }, { 229, 128,  2 }, { 230, 111,  2 }, { 230, 128,  2 },
+  { 231, 111,  2 }, { 231, 128,  2 }, { 232, 111,  2 }, { 232, 128,  2 }, { 233, 111,  2 }, { 233, 128,  2 }, { 234, 111,  2 }, { 234, 128,  2 },
+  { 235, 110,  2 }, { 235, 129,  2 }, { 236, 110,  2 }, { 236, 129,  2 }, { 237, 110,  2 }, { 237, 129,  2 }, { 238, 110,  2 }, { 238, 129,  2 },
+  { 239, 110,  2 }, { 239, 129,  2 }, { 215, 111,  1 }, { 215, 129,  1 }, { 216, 110,  2 }, { 216, 129,  2 }, { 217, 110,  2 }, { 217, 129,  2 },
+  { 218, 110,  2 }, { 218, 129,  2 }, { 219, 110,  2 }, { 219, 129,  2 }, { 220, 110,  2 }, { 220, 129,  2 }, { 221, 110,  2 }, { 221, 129,  2 },
+  { 222, 110,  2 }, { 222, 129,  2 }, { 223, 110,  1 }, { 223, 130,  1 }, { 224, 110,  1 }, { 224, 130,  1 }, { 225, 109,  2 }, { 225, 130,  2 },
+  { 226, 109,  2 }, { 226, 130,  2 }, { 227, 109,  2 }, { 227, 130,  2 }, { 228, 109,  2 }, { 228, 130,  2 }, { 229, 109,  2 }, { 229, 130,  2 },
+  { 230, 109,  2 }, { 230, 130,  2 }, { 231, 109,  2 }, { 231, 130,  2 }, { 232, 109,  2 }, { 232, 130,  2 }, { 233, 109,  2 }, { 233, 130,  2 },
+  { 234, 109,  2 }, { 234, 130,  2 }, { 235, 108,  2 }, { 235, 131,  2 }, { 236, 108,  2 }, { 236, 131,  2 }, { 237, 108,  2 }, { 237, 131,  2 },
+  { 238, 108,  2 }, { 238, 131,  2 }, { 239, 108,  2 }, { 239, 131,  2 }, { 214, 109,  2 }, { 214, 130,  2 }, { 215, 109,  2 }, { 215, 130,  2 },
+  { 216, 109,  1 }, { 216, 131,  1 }, { 217, 109,  1 }, { 217, 131,  1 }, { 218, 108,  2 }, { 218, 131,  2 }, { 219, 108,  2 }, { 219, 131,  2 },
+  { 220, 108,  2 }, { 220, 131,  2 }, { 221, 108,  2 }, { 221, 131,  2 }, { 222, 108,  2 }, { 222, 131,  2 }, { 223, 108,  2 }, { 223, 131,  2 },
+  { 224, 108,  2 }, { 224, 131,  2 }, { 225, 108,  1 }, { 225, 132,  1 }, { 226, 107,  2 }, { 226, 132,  2 }, { 227, 107,  2 }, { 227, 132,  2 },
+  { 228, 107,  2 }, { 228, 132,  2 }, { 229, 107,  2 }, { 229, 132,  2 }, { 230, 107,  2 }, { 230, 132,  2 }, { 231, 107,  2 }, { 231, 132,  2 },
+  { 232, 107,  2 }, { 232, 132,  2 }, { 233, 107,  2 }, { 233, 132,  2 }, { 234, 107,  2 }, { 234, 132,  2 }, { 235, 106,  2 }, { 235, 133,  2 },
+  { 236, 106,  2 }, { 236, 133,  2 }, { 237, 106,  2 }, { 237, 133,  2 }, { 238, 106,  2 }, { 238, 133,  2 }, { 239, 106,  2 }, { 239, 133,  2 },
+  { 214, 107,  2 }, { 214, 132,  2 }, { 215, 107,  2 }, { 215, 132,  2 }, { 216, 107,  2 }, { 216, 132,  2 }, { 217, 107,  2 }, { 217, 132,  2 },
+  { 218, 107,  1 }, { 218, 133,  1 }, { 219, 107,  1 }, { 219, 133,  1 }, { 220, 106,  2 }, { 220, 133,  2 }, { 221, 106,  2 }, { 221, 133,  2 },
+  { 222, 106,  2 }, { 222, 133,  2 }, { 223, 106,  2 }, { 223, 133,  2 }, { 224, 106,  2 }, { 224, 133,  2 }, { 225, 106,  2 }, { 225, 133,  2 },
+  { 226, 106,  1 }, { 226, 134,  1 }, { 227, 105,  2 }, { 227, 134,  2 }, { 228, 105,  2 }, { 228, 134,  2 }, { 229, 105,  2 }, { 229, 134,  2 },
+  { 230, 105,  2 }, { 230, 134,  2 }, { 231, 105,  2 }, { 231, 134,  2 }, { 232, 105,  2 }, { 232, 134,  2 }, { 233, 105,  2 }, { 233, 134,  2 },
+  { 234, 104,  3 }, { 234, 134,  3 }, { 235, 104,  2 }, { 235, 135,  2 }, { 236, 104,  2 }, { 236, 135,  2 }, { 237, 104,  2 }, { 237, 135,  2 },
+  { 238, 104,  2 }, { 238, 135,  2 }, { 239, 104,  2 }, { 239, 135,  2 }, { 214, 106,  1 }, { 214, 134,  1 }, { 215, 105,  2 }, { 215, 134,  2 },
+  { 216, 105,  2 }, { 216, 134,  2 }, { 217, 105,  2 }, { 217, 134,  2 }, { 218, 105,  2 }, { 218, 134,  2 }, { 219, 105,  2 }, { 219, 134,  2 },
+  { 220, 105,  1 }, { 220, 135,  1 }, { 221, 105,  1 }, { 221, 135,  1 }, { 222, 104,  2 }, { 222, 135,  2 }, { 223, 104,  2 }, { 223, 135,  2 },
+  { 224, 104,  2 }, { 224, 135,  2 }, { 225, 104,  2 }, { 225, 135,  2 }, { 226, 104,  2 }, { 226, 135,  2 }, { 227, 104,  1 }, { 227, 136,  1 },
+  { 228, 103,  2 }, { 228, 136,  2 }, { 229, 103,  2 }, { 229, 136,  2 }, { 230, 103,  2 }, { 230, 136,  2 }, { 231, 103,  2 }, { 231, 136,  2 },
+  { 232, 103,  2 }, { 232, 136,  2 }, { 233, 103,  2 }, { 233, 136,  2 }, { 234, 102,  2 }, { 234, 137,  2 }, { 235, 102,  2 }, { 235, 137,  2 },
+  { 236, 102,  2 }, { 236, 137,  2 }, { 237, 102,  2 }, { 237, 137,  2 }, { 238, 102,  2 }, { 238, 137,  2 }, { 239, 102,  2 }, { 239, 137,  2 },
+  { 214, 104,  2 }, { 214, 135,  2 }, { 215, 104,  1 }, { 215, 136,  1 }, { 216, 104,  1 }, { 216, 136,  1 }, { 217, 103,  2 }, { 217, 136,  2 },
+  { 218, 103,  2 }, { 218, 136,  2 }, { 219, 103,  2 }, { 219, 136,  2 }, { 220, 103,  2 }, { 220, 136,  2 }, { 221, 103,  2 }, { 221, 136,  2 },
+  { 222, 103,  1 }, { 222, 137,  1 }, { 223, 102,  2 }, { 223, 137,  2 }, { 224, 102,  2 }, { 224, 137,  2 }, { 225, 102,  2 }, { 225, 137,  2 },
+  { 226, 102,  2 }, { 226, 137,  2 }, { 227, 102,  2 }, { 227, 137,  2 }, { 228, 101,  2 }, { 228, 138,  2 }, { 229, 101,  2 }, { 229, 138,  2 },
+  { 230, 101,  2 }, { 230, 138,  2 }, { 231, 101,  2 }, { 231, 138,  2 }, { 232, 101,  2 }, { 232, 138,  2 }, { 233, 101,  2 }, { 233, 138,  2 },
+  { 234, 100,  2 }, { 234, 139,  2 }, { 235, 100,  2 }, { 235, 139,  2 }, { 236, 100,  2 }, { 236, 139,  2 }, { 237, 100,  2 }, { 237, 139,  2 },
+  { 238, 100,  2 }, { 238, 139,  2 }, { 213, 102,  2 }, { 213, 137,  2 }, { 214, 102,  2 }, { 214, 137,  2 }, { 215, 102,  2 }, { 215, 137,  2 },
+  { 216, 102,  2 }, { 216, 137,  2 }, { 217, 102,  1 }, { 217, 138,  1 }, { 218, 101,  2 }, { 218, 138,  2 }, { 219, 101,  2 }, { 219, 138,  2 },
+  { 220, 101,  2 }, { 220, 138,  2 }, { 221, 101,  2 }, { 221, 138,  2 }, { 222, 101,  2 }, { 222, 138,  2 }, { 223, 100,  2 }, { 223, 139,  2 },
+  { 224, 100,  2 }, { 224, 139,  2 }, { 225, 100,  2 }, { 225, 139,  2 }, { 226, 100,  2 }, { 226, 139,  2 }, { 227, 100,  2 }, { 227, 139,  2 },
+  { 228, 100,  1 }, { 228, 140,  1 }, { 229,  99,  2 }, { 229, 140,  2 }, { 230,  99,  2 }, { 230, 140,  2 }, { 231,  99,  2 }, { 231, 140,  2 },
+  { 232,  99,  2 }, { 232, 140,  2 }, { 233,  99,  2 }, { 233, 140,  2 }, { 234,  98,  2 }, { 234, 141,  2 }, { 235,  98,  2 }, { 235, 141,  2 },
+  { 236,  98,  2 }, { 236, 141,  2 }, { 237,  98,  2 }, { 237, 141,  2 }, { 238,  98,  2 }, { 238, 141,  2 }, { 213, 101,  1 }, { 213, 139,  1 },
+  { 214, 101,  1 }, { 214, 139,  1 }, { 215, 100,  2 }, { 215, 139,  2 }, { 216, 100,  2 }, { 216, 139,  2 }, { 217, 100,  2 }, { 217, 139,  2 },
+  { 218, 100,  1 }, { 218, 140,  1 }, { 219,  99,  2 }, { 219, 140,  2 }, { 220,  99,  2 }, { 220, 140,  2 }, { 221,  99,  2 }, { 221, 140,  2 },
+  { 222,  99,  2 }, { 222, 140,  2 }, { 223,  99,  1 }, { 223, 141,  1 }, { 224,  98,  2 }, { 224, 141,  2 }, { 225,  98,  2 }, { 225, 141,  2 },
+  { 226,  98,  2 }, { 226, 141,  2 }, { 227,  98,  2 }, { 227, 141,  2 }, { 228,  98,  2 }, { 228, 141,  2 }, { 229,  97,  2 }, { 229, 142,  2 },
+  { 230,  97,  2 }, { 230, 142,  2 }, { 231,  97,  2 }, { 231, 142,  2 }, { 232,  97,  2 }, { 232, 142,  2 }, { 233,  96,  3 }, { 233, 142,  3 },
+  { 234,  96,  2 }, { 234, 143,  2 }, { 235,  96,  2 }, { 235, 143,  2 }, { 236,  96,  2 }, { 236, 143,  2 }, { 237,  96,  2 }, { 237, 143,  2 },
+  { 238,  96,  2 }, { 238, 143,  2 }, { 213,  99,  2 }, { 213, 140,  2 }, { 214,  99,  2 }, { 214, 140,  2 }, { 215,  99,  1 }, { 215, 141,  1 },
+  { 216,  98,  2 }, { 216, 141,  2 }, { 217,  98,  2 }, { 217, 141,  2 }, { 218,  98,  2 }, { 218, 141,  2 }, { 219,  98,  1 }, { 219, 142,  1 },
+  { 220,  97,  2 }, { 220, 142,  2 }, { 221,  97,  2 }, { 221, 142,  2 }, { 222,  97,  2 }, { 222, 142,  2 }, { 223,  97,  2 }, { 223, 142,  2 },
+  { 224,  96,  2 }, { 224, 143,  2 }, { 225,  96,  2 }, { 225, 143,  2 }, { 226,  96,  2 }, { 226, 143,  2 }, { 227,  96,  2 }, { 227, 143,  2 },
+  { 228,  96,  2 }, { 228, 143,  2 }, { 229,  95,  2 }, { 229, 144,  2 }, { 230,  95,  2 }, { 230, 144,  2 }, { 231,  95,  2 }, { 231, 144,  2 },
+  { 232,  95,  2 }, { 232, 144,  2 }, { 233,  94,  2 }, { 233, 145,  2 }, { 234,  94,  2 }, { 234, 145,  2 }, { 235,  94,  2 }, { 235, 145,  2 },
+  { 236,  94,  2 }, { 236, 145,  2 }, { 237,  93,  3 }, { 237, 145,  3 }, { 212,  98,  1 }, { 212, 142,  1 }, { 213,  97,  2 }, { 213, 142,  2 },
+  { 214,  97,  2 }, { 214, 142,  2 }, { 215,  97,  2 }, { 215, 142,  2 }, { 216,  97,  1 }, { 216, 143,  1 }, { 217,  96,  2 }, { 217, 143,  2 },
+  { 218,  96,  2 }, { 218, 143,  2 }, { 219,  96,  2 }, { 219, 143,  2 }, { 220,  96,  1 }, { 220, 144,  1 }, { 221,  95,  2 }, { 221, 144,  2 },
+  { 222,  95,  2 }, { 222, 144,  2 }, { 223,  95,  2 }, { 223, 144,  2 }, { 224,  95,  1 }, { 224, 145,  1 }, { 225,  94,  2 }, { 225, 145,  2 },
+  { 226,  94,  2 }, { 226, 145,  2 }, { 227,  94,  2 }, { 227, 145,  2 }, { 228,  94,  2 }, { 228, 145,  2 }, { 229,  93,  2 }, { 229, 146,  2 },
+  { 230,  93,  2 }, { 230, 146,  2 }, { 231,  93,  2 }, { 231, 146,  2 }, { 232,  93,  2 }, { 232, 146,  2 }, { 233,  92,  2 }, { 233, 147,  2 },
+  { 234,  92,  2 }, { 234, 147,  2 }, { 235,  92,  2 }, { 235, 147,  2 }, { 236,  92,  2 }, { 236, 147,  2 }, { 237,  92,  1 }, { 237, 148,  1 },
+  { 212,  96,  2 }, { 212, 143,  2 }, { 213,  96,  1 }, { 213, 144,  1 }, { 214,  95,  2 }, { 214, 144,  2 }, { 215,  95,  2 }, { 215, 144,  2 },
+  { 216,  95,  2 }, { 216, 144,  2 }, { 217,  95,  1 }, { 217, 145,  1 }, { 218,  94,  2 }, { 218, 145,  2 }, { 219,  94,  2 }, { 219, 145,  2 },
+  { 220,  94,  2 }, { 220, 145,  2 }, { 221,  93,  2 }, { 221, 146,  2 }, { 222,  93,  2 }, { 222, 146,  2 }, { 223,  93,  2 }, { 223, 146,  2 },
+  { 224,  93,  2 }, { 224, 146,  2 }, { 225,  92,  2 }, { 225, 147,  2 }, { 226,  92,  2 }, { 226, 147,  2 }, { 227,  92,  2 }, { 227, 147,  2 },
+  { 228,  92,  2 }, { 228, 147,  2 }, { 229,  91,  2 }, { 229, 148,  2 }, { 230,  91,  2 }, { 230, 148,  2 }, { 231,  91,  2 }, { 231, 148,  2 },
+  { 232,  90,  3 }, { 232, 148,  3 }, { 233,  90,  2 }, { 233, 149,  2 }, { 234,  90,  2 }, { 234, 149,  2 }, { 235,  90,  2 }, { 235, 149,  2 },
+  { 236,  89,  3 }, { 236, 149,  3 }, { 211,  94,  1 }, { 211, 146,  1 }, { 212,  94,  2 }, { 212, 145,  2 }, { 213,  94,  2 }, { 213, 145,  2 },
+  { 214,  94,  1 }, { 214, 146,  1 }, { 215,  93,  2 }, { 215, 146,  2 }, { 216,  93,  2 }, { 216, 146,  2 }, { 217,  93,  2 }, { 217, 146,  2 },
+  { 218,  92,  2 }, { 218, 147,  2 }, { 219,  92,  2 }, { 219, 147,  2 }, { 220,  92,  2 }, { 220, 147,  2 }, { 221,  92,  1 }, { 221, 148,  1 },
+  { 222,  91,  2 }, { 222, 148,  2 }, { 223,  91,  2 }, { 223, 148,  2 }, { 224,  91,  2 }, { 224, 148,  2 }, { 225,  90,  2 }, { 225, 149,  2 },
+  { 226,  90,  2 }, { 226, 149,  2 }, { 227,  90,  2 }, { 227, 149,  2 }, { 228,  90,  2 }, { 228, 149,  2 }, { 229,  89,  2 }, { 229, 150,  2 },
+  { 230,  89,  2 }, { 230, 150,  2 }, { 231,  89,  2 }, { 231, 150,  2 }, { 232,  88,  2 }, { 232, 151,  2 }, { 233,  88,  2 }, { 233, 151,  2 },
+  { 234,  88,  2 }, { 234, 151,  2 }, { 235,  88,  2 }, { 235, 151,  2 }, { 236,  88,  1 }, { 236, 152,  1 }, { 211,  93,  1 }, { 211, 147,  1 },
+  { 212,  92,  2 }, { 212, 147,  2 }, { 213,  92,  2 }, { 213, 147,  2 }, { 214,  92,  2 }, { 214, 147,  2 }, { 215,  91,  2 }, { 215, 148,  2 },
+  { 216,  91,  2 }, { 216, 148,  2 }, { 217,  91,  2 }, { 217, 148,  2 }, { 218,  91,  1 }, { 218, 149,  1 }, { 219,  90,  2 }, { 219, 149,  2 },
+  { 220,  90,  2 }, { 220, 149,  2 }, { 221,  90,  2 }, { 221, 149,  2 }, { 222,  89,  2 }, { 222, 150,  2 }, { 223,  89,  2 }, { 223, 150,  2 },
+  { 224,  89,  2 }, { 224, 150,  2 }, { 225,  88,  2 }, { 225, 151,  2 }, { 226,  88,  2 }, { 226, 151,  2 }, { 227,  88,  2 }, { 227, 151,  2 },
+  { 228,  87,  3 }, { 228, 151,  3 }, { 229,  87,  2 }, { 229, 152,  2 }, { 230,  87,  2 }, { 230, 152,  2 }, { 231,  87,  2 }, { 231, 152,  2 },
+  { 232,  86,  2 }, { 232, 153,  2 }, { 233,  86,  2 }, { 233, 153,  2 }, { 234,  86,  2 }, { 234, 153,  2 }, { 235,  85,  3 }, { 235, 153,  3 },
+  { 210,  91,  1 }, { 210, 149,  1 }, { 211,  91,  2 }, { 211, 148,  2 }, { 212,  91,  1 }, { 212, 149,  1 }, { 213,  90,  2 }, { 213, 149,  2 },
+  { 214,  90,  2 }, { 214, 149,  2 }, { 215,  90,  1 }, { 215, 150,  1 }, { 216,  89,  2 }, { 216, 150,  2 }, { 217,  89,  2 }, { 217, 150,  2 },
+  { 218,  89,  2 }, { 218, 150,  2 }, { 219,  88,  2 }, { 219, 151,  2 }, { 220,  88,  2 }, { 220, 151,  2 }, { 221,  88,  2 }, { 221, 151,  2 },
+  { 222,  87,  2 }, { 222, 152,  2 }, { 223,  87,  2 }, { 223, 152,  2 }, { 224,  87,  2 }, { 224, 152,  2 }, { 225,  86,  2 }, { 225, 153,  2 },
+  { 226,  86,  2 }, { 226, 153,  2 }, { 227,  86,  2 }, { 227, 153,  2 }, { 228,  85,  2 }, { 228, 154,  2 }, { 229,  85,  2 }, { 229, 154,  2 },
+  { 230,  85,  2 }, { 230, 154,  2 }, { 231,  84,  3 }, { 231, 154,  3 }, { 232,  84,  2 }, { 232, 155,  2 }, { 233,  84,  2 }, { 233, 155,  2 },
+  { 234,  83,  3 }, { 234, 155,  3 }, { 210,  90,  1 }, { 210, 150,  1 }, { 211,  89,  2 }, { 211, 150,  2 }, { 212,  89,  2 }, { 212, 150,  2 },
+  { 213,  88,  2 }, { 213, 151,  2 }, { 214,  88,  2 }, { 214, 151,  2 }, { 215,  88,  2 }, { 215, 151,  2 }, { 216,  87,  2 }, { 216, 152,  2 },
+  { 217,  87,  2 }, { 217, 152,  2 }, { 218,  87,  2 }, { 218, 152,  2 }, { 219,  86,  2 }, { 219, 153,  2 }, { 220,  86,  2 }, { 220, 153,  2 },
+  { 221,  86,  2 }, { 221, 153,  2 }, { 222,  85,  2 }, { 222, 154,  2 }, { 223,  85,  2 }, { 223, 154,  2 }, { 224,  85,  2 }, { 224, 154,  2 },
+  { 225,  84,  2 }, { 225, 155,  2 }, { 226,  84,  2 }, { 226, 155,  2 }, { 227,  84,  2 }, { 227, 155,  2 }, { 228,  83,  2 }, { 228, 156,  2 },
+  { 229,  83,  2 }, { 229, 156,  2 }, { 230,  83,  2 }, { 230, 156,  2 }, { 231,  82,  2 }, { 231, 157,  2 }, { 232,  82,  2 }, { 232, 157,  2 },
+  { 233,  82,  2 }, { 233, 157,  2 }, { 234,  81,  2 }, { 234, 158,  2 }, { 209,  88,  1 }, { 209, 152,  1 }, { 210,  88,  2 }, { 210, 151,  2 },
+  { 211,  87,  2 }, { 211, 152,  2 }, { 212,  87,  2 }, { 212, 152,  2 }, { 213,  87,  1 }, { 213, 153,  1 }, { 214,  86,  2 }, { 214, 153,  2 },
+  { 215,  86,  2 }, { 215, 153,  2 }, { 216,  86,  1 }, { 216, 154,  1 }, { 217,  85,  2 }, { 217, 154,  2 }, { 218,  85,  2 }, { 218, 154,  2 },
+  { 219,  84,  2 }, { 219, 155,  2 }, { 220,  84,  2 }, { 220, 155,  2 }, { 221,  84,  2 }, { 221, 155,  2 }, { 222,  83,  2 }, { 222, 156,  2 },
+  { 223,  83,  2 }, { 223, 156,  2 }, { 224,  83,  2 }, { 224, 156,  2 }, { 225,  82,  2 }, { 225, 157,  2 }, { 226,  82,  2 }, { 226, 157,  2 },
+  { 227,  82,  2 }, { 227, 157,  2 }, { 228,  81,  2 }, { 228, 158,  2 }, { 229,  81,  2 }, { 229, 158,  2 }, { 230,  80,  3 }, { 230, 158,  3 },
+  { 231,  80,  2 }, { 231, 159,  2 }, { 232,  80,  2 }, { 232, 159,  2 }, { 233,  79,  3 }, { 233, 159,  3 }, { 209,  86,  2 }, { 209, 153,  2 },
+  { 210,  86,  2 }, { 210, 153,  2 }, { 211,  86,  1 }, { 211, 154,  1 }, { 212,  85,  2 }, { 212, 154,  2 }, { 213,  85,  2 }, { 213, 154,  2 },
+  { 214,  84,  2 }, { 214, 155,  2 }, { 215,  84,  2 }, { 215, 155,  2 }, { 216,  84,  2 }, { 216, 155,  2 }, { 217,  83,  2 }, { 217, 156,  2 },
+  { 218,  83,  2 }, { 218, 156,  2 }, { 219,  82,  2 }, { 219, 157,  2 }, { 220,  82,  2 }, { 220, 157,  2 }, { 221,  82,  2 }, { 221, 157,  2 },
+  { 222,  81,  2 }, { 222, 158,  2 }, { 223,  81,  2 }, { 223, 158,  2 }, { 224,  81,  2 }, { 224, 158,  2 }, { 225,  80,  2 }, { 225, 159,  2 },
+  { 226,  80,  2 }, { 226, 159,  2 }, { 227,  79,  3 }, { 227, 159,  3 }, { 228,  79,  2 }, { 228, 160,  2 }, { 229,  79,  2 }, { 229, 160,  2 },
+  { 230,  78,  2 }, { 230, 161,  2 }, { 231,  78,  2 }, { 231, 161,  2 }, { 232,  78,  2 }, { 232, 161,  2 }, { 208,  85,  1 }, { 208, 155,  1 },
+  { 209,  85,  1 }, { 209, 155,  1 }, { 210,  84,  2 }, { 210, 155,  2 }, { 211,  84,  2 }, { 211, 155,  2 }, { 212,  83,  2 }, { 212, 156,  2 },
+  { 213,  83,  2 }, { 213, 156,  2 }, { 214,  83,  1 }, { 214, 157,  1 }, { 215,  82,  2 }, { 215, 157,  2 }, { 216,  82,  2 }, { 216, 157,  2 },
+  { 217,  81,  2 }, { 217, 158,  2 }, { 218,  81,  2 }, { 218, 158,  2 }, { 219,  81,  1 }, { 219, 159,  1 }, { 220,  80,  2 }, { 220, 159,  2 },
+  { 221,  80,  2 }, { 221, 159,  2 }, { 222,  79,  2 }, { 222, 160,  2 }, { 223,  79,  2 }, { 223, 160,  2 }, { 224,  78,  3 }, { 224, 160,  3 },
+  { 225,  78,  2 }, { 225, 161,  2 }, { 226,  78,  2 }, { 226, 161,  2 }, { 227,  77,  2 }, { 227, 162,  2 }, { 228,  77,  2 }, { 228, 162,  2 },
+  { 229,  76,  3 }, { 229, 162,  3 }, { 230,  76,  2 }, { 230, 163,  2 }, { 231,  76,  2 }, { 231, 163,  2 }, { 232,  76,  2 }, { 232, 163,  2 },
+  { 208,  83,  2 }, { 208, 156,  2 }, { 209,  83,  2 }, { 209, 156,  2 }, { 210,  82,  2 }, { 210, 157,  2 }, { 211,  82,  2 }, { 211, 157,  2 },
+  { 212,  81,  2 }, { 212, 158,  2 }, { 213,  81,  2 }, { 213, 158,  2 }, { 214,  81,  2 }, { 214, 158,  2 }, { 215,  80,  2 }, { 215, 159,  2 },
+  { 216,  80,  2 }, { 216, 159,  2 }, { 217,  79,  2 }, { 217, 160,  2 }, { 218,  79,  2 }, { 218, 160,  2 }, { 219,  78,  3 }, { 219, 160,  3 },
+  { 220,  78,  2 }, { 220, 161,  2 }, { 221,  78,  2 }, { 221, 161,  2 }, { 222,  77,  2 }, { 222, 162,  2 }, { 223,  77,  2 }, { 223, 162,  2 },
+  { 224,  76,  2 }, { 224, 163,  2 }, { 225,  76,  2 }, { 225, 163,  2 }, { 226,  76,  2 }, { 226, 163,  2 }, { 227,  75,  2 }, { 227, 164,  2 },
+  { 228,  75,  2 }, { 228, 164,  2 }, { 229,  74,  2 }, { 229, 165,  2 }, { 230,  74,  2 }, { 230, 165,  2 }, { 231,  74,  2 }, { 231, 165,  2 },
+  { 207,  82,  2 }, { 207, 157,  2 }, { 208,  81,  2 }, { 208, 158,  2 }, { 209,  81,  2 }, { 209, 158,  2 }, { 210,  80,  2 }, { 210, 159,  2 },
+  { 211,  80,  2 }, { 211, 159,  2 }, { 212,  80,  1 }, { 212, 160,  1 }, { 213,  79,  2 }, { 213, 160,  2 }, { 214,  79,  2 }, { 214, 160,  2 },
+  { 215,  78,  2 }, { 215, 161,  2 }, { 216,  78,  2 }, { 216, 161,  2 }, { 217,  77,  2 }, { 217, 162,  2 }, { 218,  77,  2 }, { 218, 162,  2 },
+  { 219,  76,  2 }, { 219, 163,  2 }, { 220,  76,  2 }, { 220, 163,  2 }, { 221,  76,  2 }, { 221, 163,  2 }, { 222,  75,  2 }, { 222, 164,  2 },
+  { 223,  75,  2 }, { 223, 164,  2 }, { 224,  74,  2 }, { 224, 165,  2 }, { 225,  74,  2 }, { 225, 165,  2 }, { 226,  73,  3 }, { 226, 165,  3 },
+  { 227,  73,  2 }, { 227, 166,  2 }, { 228,  72,  3 }, { 228, 166,  3 }, { 229,  72,  2 }, { 229, 167,  2 }, { 230,  72,  2 }, { 230, 167,  2 },
+  { 206,  80,  1 }, { 206, 160,  1 }, { 207,  80,  2 }, { 207, 159,  2 }, { 208,  79,  2 }, { 208, 160,  2 }, { 209,  79,  2 }, { 209, 160,  2 },
+  { 210,  79,  1 }, { 210, 161,  1 }, { 211,  78,  2 }, { 211, 161,  2 }, { 212,  78,  2 }, { 212, 161,  2 }, { 213,  77,  2 }, { 213, 162,  2 },
+  { 214,  77,  2 }, { 214, 162,  2 }, { 215,  76,  2 }, { 215, 163,  2 }, { 216,  76,  2 }, { 216, 163,  2 }, { 217,  75,  2 }, { 217, 164,  2 },
+  { 218,  75,  2 }, { 218, 164,  2 }, { 219,  74,  2 }, { 219, 165,  2 }, { 220,  74,  2 }, { 220, 165,  2 }, { 221,  73,  3 }, { 221, 165,  3 },
+  { 222,  73,  2 }, { 222, 166,  2 }, { 223,  72,  3 }, { 223, 166,  3 }, { 224,  72,  2 }, { 224, 167,  2 }, { 225,  72,  2 }, { 225, 167,  2 },
+  { 226,  71,  2 }, { 226, 168,  2 }, { 227,  71,  2 }, { 227, 168,  2 }, { 228,  70,  2 }, { 228, 169,  2 }, { 229,  70,  2 }, { 229, 169,  2 },
+  { 230,  71,  1 }, { 230, 169,  1 }, { 206,  79,  1 }, { 206, 161,  1 }, { 207,  78,  2 }, { 207, 161,  2 }, { 208,  78,  1 }, { 208, 162,  1 },
+  { 209,  77,  2 }, { 209, 162,  2 }, { 210,  77,  2 }, { 210, 162,  2 }, { 211,  76,  2 }, { 211, 163,  2 }, { 212,  76,  2 }, { 212, 163,  2 },
+  { 213,  75,  2 }, { 213, 164,  2 }, { 214,  75,  2 }, { 214, 164,  2 }, { 215,  74,  2 }, { 215, 165,  2 }, { 216,  74,  2 }, { 216, 165,  2 },
+  { 217,  73,  2 }, { 217, 166,  2 }, { 218,  73,  2 }, { 218, 166,  2 }, { 219,  72,  2 }, { 219, 167,  2 }, { 220,  72,  2 }, { 220, 167,  2 },
+  { 221,  71,  2 }, { 221, 168,  2 }, { 222,  71,  2 }, { 222, 168,  2 }, { 223,  70,  2 }, { 223, 169,  2 }, { 224,  70,  2 }, { 224, 169,  2 },
+  { 225,  69,  3 }, { 225, 169,  3 }, { 226,  69,  2 }, { 226, 170,  2 }, { 227,  68,  3 }, { 227, 170,  3 }, { 228,  68,  2 }, { 228, 171,  2 },
+  { 229,  69,  1 }, { 229, 171,  1 }, { 205,  77,  2 }, { 205, 162,  2 }, { 206,  77,  2 }, { 206, 162,  2 }, { 207,  76,  2 }, { 207, 163,  2 },
+  { 208,  76,  2 }, { 208, 163,  2 }, { 209,  75,  2 }, { 209, 164,  2 }, { 210,  75,  2 }, { 210, 164,  2 }, { 211,  74,  2 }, { 211, 165,  2 },
+  { 212,  74,  2 }, { 212, 165,  2 }, { 213,  73,  2 }, { 213, 166,  2 }, { 214,  73,  2 }, { 214, 166,  2 }, { 215,  72,  2 }, { 215, 167,  2 },
+  { 216,  72,  2 }, { 216, 167,  2 }, { 217,  71,  2 }, { 217, 168,  2 }, { 218,  71,  2 }, { 218, 168,  2 }, { 219,  70,  2 }, { 219, 169,  2 },
+  { 220,  70,  2 }, { 220, 169,  2 }, { 221,  69,  2 }, { 221, 170,  2 }, { 222,  69,  2 }, { 222, 170,  2 }, { 223,  68,  2 }, { 223, 171,  2 },
+  { 224,  68,  2 }, { 224, 171,  2 }, { 225,  67,  2 }, { 225, 172,  2 }, { 226,  66,  3 }, { 226, 172,  3 }, { 227,  66,  2 }, { 227, 173,  2 },
+  { 228,  67,  1 }, { 228, 173,  1 }, { 204,  76,  1 }, { 204, 164,  1 }, { 205,  75,  2 }, { 205, 164,  2 }, { 206,  75,  2 }, { 206, 164,  2 },
+  { 207,  74,  2 }, { 207, 165,  2 }, { 208,  74,  2 }, { 208, 165,  2 }, { 209,  73,  2 }, { 209, 166,  2 }, { 210,  73,  2 }, { 210, 166,  2 },
+  { 211,  72,  2 }, { 211, 167,  2 }, { 212,  72,  2 }, { 212, 167,  2 }, { 213,  71,  2 }, { 213, 168,  2 }, { 214,  71,  2 }, { 214, 168,  2 },
+  { 215,  70,  2 }, { 215, 169,  2 }, { 216,  69,  3 }, { 216, 169,  3 }, { 217,  69,  2 }, { 217, 170,  2 }, { 218,  68,  3 }, { 218, 170,  3 },
+  { 219,  68,  2 }, { 219, 171,  2 }, { 220,  67,  3 }, { 220, 171,  3 }, { 221,  67,  2 }, { 221, 172,  2 }, { 222,  66,  3 }, { 222, 172,  3 },
+  { 223,  66,  2 }, { 223, 173,  2 }, { 224,  65,  3 }, { 224, 173,  3 }, { 225,  65,  2 }, { 225, 174,  2 }, { 226,  64,  2 }, { 226, 175,  2 },
+  { 227,  65,  1 }, { 227, 175,  1 }, { 203,  74,  1 }, { 203, 166,  1 }, { 204,  74,  2 }, { 204, 165,  2 }, { 205,  73,  2 }, { 205, 166,  2 },
+  { 206,  73,  2 }, { 206, 166,  2 }, { 207,  72,  2 }, { 207, 167,  2 }, { 208,  72,  2 }, { 208, 167,  2 }, { 209,  71,  2 }, { 209, 168,  2 },
+  { 210,  71,  2 }, { 210, 168,  2 }, { 211,  70,  2 }, { 211, 169,  2 }, { 212,  70,  2 }, { 212, 169,  2 }, { 213,  69,  2 }, { 213, 170,  2 },
+  { 214,  68,  3 }, { 214, 170,  3 }, { 215,  68,  2 }, { 215, 171,  2 }, { 216,  67,  2 }, { 216, 172,  2 }, { 217,  67,  2 }, { 217, 172,  2 },
+  { 218,  66,  2 }, { 218, 173,  2 }, { 219,  66,  2 }, { 219, 173,  2 }, { 220,  65,  2 }, { 220, 174,  2 }, { 221,  65,  2 }, { 221, 174,  2 },
+  { 222,  64,  2 }, { 222, 175,  2 }, { 223,  63,  3 }, { 223, 175,  3 }, { 224,  63,  2 }, { 224, 176,  2 }, { 225,  62,  3 }, { 225, 176,  3 },
+  { 226,  63,  1 }, { 226, 177,  1 }, { 202,  73,  1 }, { 202, 167,  1 }, { 203,  73,  1 }, { 203, 167,  1 }, { 204,  72,  2 }, { 204, 167,  2 },
+  { 205,  71,  2 }, { 205, 168,  2 }, { 206,  71,  2 }, { 206, 168,  2 }, { 207,  70,  2 }, { 207, 169,  2 }, { 208,  70,  2 }, { 208, 169,  2 },
+  { 209,  69,  2 }, { 209, 170,  2 }, { 210,  69,  2 }, { 210, 170,  2 }, { 211,  68,  2 }, { 211, 171,  2 }, { 212,  67,  3 }, { 212, 171,  3 },
+  { 213,  67,  2 }, { 213, 172,  2 }, { 214,  66,  2 }, { 214, 173,  2 }, { 215,  66,  2 }, { 215, 173,  2 }, { 216,  65,  2 }, { 216, 174,  2 },
+  { 217,  64,  3 }, { 217, 174,  3 }, { 218,  64,  2 }, { 218, 175,  2 }, { 219,  63,  3 }, { 219, 175,  3 }, { 220,  63,  2 }, { 220, 176,  2 },
+  { 221,  62,  3 }, { 221, 176,  3 }, { 222,  62,  2 }, { 222, 177,  2 }, { 223,  61,  2 }, { 223, 178,  2 }, { 224,  60,  3 }, { 224, 178,  3 },
+  { 225,  61,  1 }, { 225, 179,  1 }, { 202,  71,  2 }, { 202, 168,  2 }, { 203,  71,  2 }, { 203, 168,  2 }, { 204,  70,  2 }, { 204, 169,  2 },
+  { 205,  69,  2 }, { 205, 170,  2 }, { 206,  69,  2 }, { 206, 170,  2 }, { 207,  68,  2 }, { 207, 171,  2 }, { 208,  68,  2 }, { 208, 171,  2 },
+  { 209,  67,  2 }, { 209, 172,  2 }, { 210,  66,  3 }, { 210, 172,  3 }, { 211,  66,  2 }, { 211, 173,  2 }, { 212,  65,  2 }, { 212, 174,  2 },
+  { 213,  65,  2 }, { 213, 174,  2 }, { 214,  64,  2 }, { 214, 175,  2 }, { 215,  63,  3 }, { 215, 175,  3 }, { 216,  63,  2 }, { 216, 176,  2 },
+  { 217,  62,  2 }, { 217, 177,  2 }, { 218,  62,  2 }, { 218, 177,  2 }, { 219,  61,  2 }, { 219, 178,  2 }, { 220,  60,  3 }, { 220, 178,  3 },
+  { 221,  60,  2 }, { 221, 179,  2 }, { 222,  59,  3 }, { 222, 179,  3 }, { 223,  59,  2 }, { 223, 180,  2 }, { 201,  70,  2 }, { 201, 169,  2 },
+  { 202,  69,  2 }, { 202, 170,  2 }, { 203,  69,  2 }, { 203, 170,  2 }, { 204,  68,  2 }, { 204, 171,  2 }, { 205,  67,  2 }, { 205, 172,  2 },
+  { 206,  67,  2 }, { 206, 172,  2 }, { 207,  66,  2 }, { 207, 173,  2 }, { 208,  66,  2 }, { 208, 173,  2 }, { 209,  65,  2 }, { 209, 174,  2 },
+  { 210,  64,  2 }, { 210, 175,  2 }, { 211,  64,  2 }, { 211, 175,  2 }, { 212,  63,  2 }, { 212, 176,  2 }, { 213,  62,  3 }, { 213, 176,  3 },
+  { 214,  62,  2 }, { 214, 177,  2 }, { 215,  61,  2 }, { 215, 178,  2 }, { 216,  61,  2 }, { 216, 178,  2 }, { 217,  60,  2 }, { 217, 179,  2 },
+  { 218,  59,  3 }, { 218, 179,  3 }, { 219,  59,  2 }, { 219, 180,  2 }, { 220,  58,  2 }, { 220, 181,  2 }, { 221,  57,  3 }, { 221, 181,  3 },
+  { 222,  57,  2 }, { 222, 182,  2 }, { 223,  58,  1 }, { 223, 182,  1 }, { 200,  69,  1 }, { 200, 171,  1 }, { 201,  68,  2 }, { 201, 171,  2 },
+  { 202,  67,  2 }, { 202, 172,  2 }, { 203,  67,  2 }, { 203, 172,  2 }, { 204,  66,  2 }, { 204, 173,  2 }, { 205,  65,  2 }, { 205, 174,  2 },
+  { 206,  65,  2 }, { 206, 174,  2 }, { 207,  64,  2 }, { 207, 175,  2 }, { 208,  63,  3 }, { 208, 175,  3 }, { 209,  63,  2 }, { 209, 176,  2 },
+  { 210,  62,  2 }, { 210, 177,  2 }, { 211,  61,  3 }, { 211, 177,  3 }, { 212,  61,  2 }, { 212, 178,  2 }, { 213,  60,  2 }, { 213, 179,  2 },
+  { 214,  59,  3 }, { 214, 179,  3 }, { 215,  59,  2 }, { 215, 180,  2 }, { 216,  58,  3 }, { 216, 180,  3 }, { 217,  58,  2 }, { 217, 181,  2 },
+  { 218,  57,  2 }, { 218, 182,  2 }, { 219,  56,  3 }, { 219, 182,  3 }, { 220,  56,  2 }, { 220, 183,  2 }, { 221,  55,  2 }, { 221, 184,  2 },
+  { 222,  56,  1 }, { 222, 184,  1 }, { 199,  67,  2 }, { 199, 172,  2 }, { 200,  67,  2 }, { 200, 172,  2 }, { 201,  66,  2 }, { 201, 173,  2 },
+  { 202,  65,  2 }, { 202, 174,  2 }, { 203,  65,  2 }, { 203, 174,  2 }, { 204,  64,  2 }, { 204, 175,  2 }, { 205,  63,  2 }, { 205, 176,  2 },
+  { 206,  62,  3 }, { 206, 176,  3 }, { 207,  62,  2 }, { 207, 177,  2 }, { 208,  61,  2 }, { 208, 178,  2 }, { 209,  60,  3 }, { 209, 178,  3 },
+  { 210,  60,  2 }, { 210, 179,  2 }, { 211,  59,  2 }, { 211, 180,  2 }, { 212,  58,  3 }, { 212, 180,  3 }, { 213,  58,  2 }, { 213, 181,  2 },
+  { 214,  57,  2 }, { 214, 182,  2 }, { 215,  56,  3 }, { 215, 182,  3 }, { 216,  56,  2 }, { 216, 183,  2 }, { 217,  55,  3 }, { 217, 183,  3 },
+  { 218,  54,  3 }, { 218, 184,  3 }, { 219,  54,  2 }, { 219, 185,  2 }, { 220,  53,  3 }, { 220, 185,  3 }, { 198,  66,  1 }, { 198, 174,  1 },
+  { 199,  65,  2 }, { 199, 174,  2 }, { 200,  64,  3 }, { 200, 174,  3 }, { 201,  64,  2 }, { 201, 175,  2 }, { 202,  63,  2 }, { 202, 176,  2 },
+  { 203,  62,  3 }, { 203, 176,  3 }, { 204,  62,  2 }, { 204, 177,  2 }, { 205,  61,  2 }, { 205, 178,  2 }, { 206,  60,  2 }, { 206, 179,  2 },
+  { 207,  60,  2 }, { 207, 179,  2 }, { 208,  59,  2 }, { 208, 180,  2 }, { 209,  58,  2 }, { 209, 181,  2 }, { 210,  57,  3 }, { 210, 181,  3 },
+  { 211,  57,  2 }, { 211, 182,  2 }, { 212,  56,  2 }, { 212, 183,  2 }, { 213,  55,  3 }, { 213, 183,  3 }, { 214,  55,  2 }, { 214, 184,  2 },
+  { 215,  54,  2 }, { 215, 185,  2 }, { 216,  53,  3 }, { 216, 185,  3 }, { 217,  53,  2 }, { 217, 186,  2 }, { 218,  52,  2 }, { 218, 187,  2 },
+  { 219,  52,  2 }, { 219, 187,  2 }, { 197,  65,  1 }, { 197, 175,  1 }, { 198,  64,  2 }, { 198, 175,  2 }, { 199,  63,  2 }, { 199, 176,  2 },
+  { 200,  62,  2 }, { 200, 177,  2 }, { 201,  62,  2 }, { 201, 177,  2 }, { 202,  61,  2 }, { 202, 178,  2 }, { 203,  60,  2 }, { 203, 179,  2 },
+  { 204,  59,  3 }, { 204, 179,  3 }, { 205,  59,  2 }, { 205, 180,  2 }, { 206,  58,  2 }, { 206, 181,  2 }, { 207,  57,  3 }, { 207, 181,  3 },
+  { 208,  57,  2 }, { 208, 182,  2 }, { 209,  56,  2 }, { 209, 183,  2 }, { 210,  55,  2 }, { 210, 184,  2 }, { 211,  54,  3 }, { 211, 184,  3 },
+  { 212,  54,  2 }, { 212, 185,  2 }, { 213,  53,  2 }, { 213, 186,  2 }, { 214,  52,  3 }, { 214, 186,  3 }, { 215,  51,  3 }, { 215, 187,  3 },
+  { 216,  51,  2 }, { 216, 188,  2 }, { 217,  50,  3 }, { 217, 188,  3 }, { 218,  50,  2 }, { 218, 189,  2 }, { 196,  63,  1 }, { 196, 177,  1 },
+  { 197,  62,  3 }, { 197, 176,  3 }, { 198,  62,  2 }, { 198, 177,  2 }, { 199,  61,  2 }, { 199, 178,  2 }, { 200,  60,  2 }, { 200, 179,  2 },
+  { 201,  59,  3 }, { 201, 179,  3 }, { 202,  59,  2 }, { 202, 180,  2 }, { 203,  58,  2 }, { 203, 181,  2 }, { 204,  57,  2 }, { 204, 182,  2 },
+  { 205,  56,  3 }, { 205, 182,  3 }, { 206,  56,  2 }, { 206, 183,  2 }, { 207,  55,  2 }, { 207, 184,  2 }, { 208,  54,  3 }, { 208, 184,  3 },
+  { 209,  53,  3 }, { 209, 185,  3 }, { 210,  53,  2 }, { 210, 186,  2 }, { 211,  52,  2 }, { 211, 187,  2 }, { 212,  51,  3 }, { 212, 187,  3 },
+  { 213,  50,  3 }, { 213, 188,  3 }, { 214,  50,  2 }, { 214, 189,  2 }, { 215,  49,  2 }, { 215, 190,  2 }, { 216,  48,  3 }, { 216, 190,  3 },
+  { 217,  49,  1 }, { 217, 191,  1 }, { 195,  62,  1 }, { 195, 178,  1 }, { 196,  61,  2 }, { 196, 178,  2 }, { 197,  60,  2 }, { 197, 179,  2 },
+  { 198,  60,  2 }, { 198, 179,  2 }, { 199,  59,  2 }, { 199, 180,  2 }, { 200,  58,  2 }, { 200, 181,  2 }, { 201,  57,  2 }, { 201, 182,  2 },
+  { 202,  56,  3 }, { 202, 182,  3 }, { 203,  56,  2 }, { 203, 183,  2 }, { 204,  55,  2 }, { 204, 184,  2 }, { 205,  54,  2 }, { 205, 185,  2 },
+  { 206,  53,  3 }, { 206, 185,  3 }, { 207,  53,  2 }, { 207, 186,  2 }, { 208,  52,  2 }, { 208, 187,  2 }, { 209,  51,  2 }, { 209, 188,  2 },
+  { 210,  50,  3 }, { 210, 188,  3 }, { 211,  49,  3 }, { 211, 189,  3 }, { 212,  49,  2 }, { 212, 190,  2 }, { 213,  48,  2 }, { 213, 191,  2 },
+  { 214,  47,  3 }, { 214, 191,  3 }, { 215,  46,  3 }, { 215, 192,  3 }, { 194,  61,  1 }, { 194, 179,  1 }, { 195,  60,  2 }, { 195, 179,  2 },
+  { 196,  59,  2 }, { 196, 180,  2 }, { 197,  58,  2 }, { 197, 181,  2 }, { 198,  57,  3 }, { 198, 181,  3 }, { 199,  57,  2 }, { 199, 182,  2 },
+  { 200,  56,  2 }, { 200, 183,  2 }, { 201,  55,  2 }, { 201, 184,  2 }, { 202,  54,  2 }, { 202, 185,  2 }, { 203,  53,  3 }, { 203, 185,  3 },
+  { 204,  52,  3 }, { 204, 186,  3 }, { 205,  52,  2 }, { 205, 187,  2 }, { 206,  51,  2 }, { 206, 188,  2 }, { 207,  50,  3 }, { 207, 188,  3 },
+  { 208,  49,  3 }, { 208, 189,  3 }, { 209,  48,  3 }, { 209, 190,  3 }, { 210,  48,  2 }, { 210, 191,  2 }, { 211,  47,  2 }, { 211, 192,  2 },
+  { 212,  46,  3 }, { 212, 192,  3 }, { 213,  45,  3 }, { 213, 193,  3 }, { 214,  45,  2 }, { 214, 194,  2 }, { 193,  59,  1 }, { 193, 181,  1 },
+  { 194,  58,  3 }, { 194, 180,  3 }, { 195,  58,  2 }, { 195, 181,  2 }, { 196,  57,  2 }, { 196, 182,  2 }, { 197,  56,  2 }, { 197, 183,  2 },
+  { 198,  55,  2 }, { 198, 184,  2 }, { 199,  54,  3 }, { 199, 184,  3 }, { 200,  53,  3 }, { 200, 185,  3 }, { 201,  53,  2 }, { 201, 186,  2 },
+  { 202,  52,  2 }, { 202, 187,  2 }, { 203,  51,  2 }, { 203, 188,  2 }, { 204,  50,  2 }, { 204, 189,  2 }, { 205,  49,  3 }, { 205, 189,  3 },
+  { 206,  48,  3 }, { 206, 190,  3 }, { 207,  47,  3 }, { 207, 191,  3 }, { 208,  47,  2 }, { 208, 192,  2 }, { 209,  46,  2 }, { 209, 193,  2 },
+  { 210,  45,  3 }, { 210, 193,  3 }, { 211,  44,  3 }, { 211, 194,  3 }, { 212,  43,  3 }, { 212, 195,  3 }, { 213,  44,  1 }, { 213, 196,  1 },
+  { 192,  58,  1 }, { 192, 182,  1 }, { 193,  57,  2 }, { 193, 182,  2 }, { 194,  56,  2 }, { 194, 183,  2 }, { 195,  55,  3 }, { 195, 183,  3 },
+  { 196,  54,  3 }, { 196, 184,  3 }, { 197,  54,  2 }, { 197, 185,  2 }, { 198,  53,  2 }, { 198, 186,  2 }, { 199,  52,  2 }, { 199, 187,  2 },
+  { 200,  51,  2 }, { 200, 188,  2 }, { 201,  50,  3 }, { 201, 188,  3 }, { 202,  49,  3 }, { 202, 189,  3 }, { 203,  48,  3 }, { 203, 190,  3 },
+  { 204,  47,  3 }, { 204, 191,  3 }, { 205,  47,  2 }, { 205, 192,  2 }, { 206,  46,  2 }, { 206, 193,  2 }, { 207,  45,  2 }, { 207, 194,  2 },
+  { 208,  44,  3 }, { 208, 194,  3 }, { 209,  43,  3 }, { 209, 195,  3 }, { 210,  42,  3 }, { 210, 196,  3 }, { 211,  42,  2 }, { 211, 197,  2 },
+  { 191,  57,  1 }, { 191, 183,  1 }, { 192,  56,  2 }, { 192, 183,  2 }, { 193,  55,  2 }, { 193, 184,  2 }, { 194,  54,  2 }, { 194, 185,  2 },
+  { 195,  53,  2 }, { 195, 186,  2 }, { 196,  52,  2 }, { 196, 187,  2 }, { 197,  51,  3 }, { 197, 187,  3 }, { 198,  50,  3 }, { 198, 188,  3 },
+  { 199,  49,  3 }, { 199, 189,  3 }, { 200,  48,  3 }, { 200, 190,  3 }, { 201,  48,  2 }, { 201, 191,  2 }, { 202,  47,  2 }, { 202, 192,  2 },
+  { 203,  46,  2 }, { 203, 193,  2 }, { 204,  45,  2 }, { 204, 194,  2 }, { 205,  44,  3 }, { 205, 194,  3 }, { 206,  43,  3 }, { 206, 195,  3 },
+  { 207,  42,  3 }, { 207, 196,  3 }, { 208,  41,  3 }, { 208, 197,  3 }, { 209,  40,  3 }, { 209, 198,  3 }, { 210,  40,  2 }, { 210, 199,  2 },
+  { 190,  55,  2 }, { 190, 184,  2 }, { 191,  54,  3 }, { 191, 184,  3 }, { 192,  53,  3 }, { 192, 185,  3 }, { 193,  52,  3 }, { 193, 186,  3 },
+  { 194,  51,  3 }, { 194, 187,  3 }, { 195,  51,  2 }, { 195, 188,  2 }, { 196,  50,  2 }, { 196, 189,  2 }, { 197,  49,  2 }, { 197, 190,  2 },
+  { 198,  48,  2 }, { 198, 191,  2 }, { 199,  47,  2 }, { 199, 192,  2 }, { 200,  46,  2 }, { 200, 193,  2 }, { 201,  45,  3 }, { 201, 193,  3 },
+  { 202,  44,  3 }, { 202, 194,  3 }, { 203,  43,  3 }, { 203, 195,  3 }, { 204,  42,  3 }, { 204, 196,  3 }, { 205,  41,  3 }, { 205, 197,  3 },
+  { 206,  40,  3 }, { 206, 198,  3 }, { 207,  39,  3 }, { 207, 199,  3 }, { 208,  38,  3 }, { 208, 200,  3 }, { 209,  39,  1 }, { 209, 201,  1 },
+  { 189,  54,  2 }, { 189, 185,  2 }, { 190,  53,  2 }, { 190, 186,  2 }, { 191,  52,  2 }, { 191, 187,  2 }, { 192,  51,  2 }, { 192, 188,  2 },
+  { 193,  50,  2 }, { 193, 189,  2 }, { 194,  49,  2 }, { 194, 190,  2 }, { 195,  48,  3 }, { 195, 190,  3 }, { 196,  47,  3 }, { 196, 191,  3 },
+  { 197,  46,  3 }, { 197, 192,  3 }, { 198,  45,  3 }, { 198, 193,  3 }, { 199,  44,  3 }, { 199, 194,  3 }, { 200,  43,  3 }, { 200, 195,  3 },
+  { 201,  42,  3 }, { 201, 196,  3 }, { 202,  41,  3 }, { 202, 197,  3 }, { 203,  40,  3 }, { 203, 198,  3 }, { 204,  39,  3 }, { 204, 199,  3 },
+  { 205,  38,  3 }, { 205, 200,  3 }, { 206,  37,  3 }, { 206, 201,  3 }, { 207,  37,  2 }, { 207, 202,  2 }, { 188,  53,  2 }, { 188, 186,  2 },
+  { 189,  52,  2 }, { 189, 187,  2 }, { 190,  51,  2 }, { 190, 188,  2 }, { 191,  50,  2 }, { 191, 189,  2 }, { 192,  49,  2 }, { 192, 190,  2 },
+  { 193,  48,  2 }, { 193, 191,  2 }, { 194,  47,  2 }, { 194, 192,  2 }, { 195,  46,  2 }, { 195, 193,  2 }, { 196,  45,  2 }, { 196, 194,  2 },
+  { 197,  44,  2 }, { 197, 195,  2 }, { 198,  43,  2 }, { 198, 196,  2 }, { 199,  42,  2 }, { 199, 197,  2 }, { 200,  41,  2 }, { 200, 198,  2 },
+  { 201,  40,  2 }, { 201, 199,  2 }, { 202,  39,  2 }, { 202, 200,  2 }, { 203,  38,  2 }, { 203, 201,  2 }, { 204,  37,  2 }, { 204, 202,  2 },
+  { 205,  36,  2 }, { 205, 203,  2 }, { 206,  36,  1 }, { 206, 204,  1 }, { 186,  52,  1 }, { 186, 188,  1 }, { 187,  51,  3 }, { 187, 187,  3 },
+  { 188,  50,  3 }, { 188, 188,  3 }, { 189,  49,  3 }, { 189, 189,  3 }, { 190,  48,  3 }, { 190, 190,  3 }, { 191,  47,  3 }, { 191, 191,  3 },
+  { 192,  46,  3 }, { 192, 192,  3 }, { 193,  45,  3 }, { 193, 193,  3 }, { 194,  44,  3 }, { 194, 194,  3 }, { 195,  43,  3 }, { 195, 195,  3 },
+  { 196,  42,  3 }, { 196, 196,  3 }, { 197,  41,  3 }, { 197, 197,  3 }, { 198,  40,  3 }, { 198, 198,  3 }, { 199,  39,  3 }, { 199, 199,  3 },
+  { 200,  38,  3 }, { 200, 200,  3 }, { 201,  37,  3 }, { 201, 201,  3 }, { 202,  36,  3 }, { 202, 202,  3 }, { 203,  35,  3 }, { 203, 203,  3 },
+  { 204,  34,  3 }, { 204, 204,  3 }, { 205,  35,  1 }, { 205, 205,  1 }, { 185,  51,  1 }, { 185, 189,  1 }, { 186,  50,  2 }, { 186, 189,  2 },
+  { 187,  49,  2 }, { 187, 190,  2 }, { 188,  48,  2 }, { 188, 191,  2 }, { 189,  47,  2 }, { 189, 192,  2 }, { 190,  45,  3 }, { 190, 193,  3 },
+  { 191,  44,  3 }, { 191, 194,  3 }, { 192,  43,  3 }, { 192, 195,  3 }, { 193,  42,  3 }, { 193, 196,  3 }, { 194,  41,  3 }, { 194, 197,  3 },
+  { 195,  40,  3 }, { 195, 198,  3 }, { 196,  39,  3 }, { 196, 199,  3 }, { 197,  38,  3 }, { 197, 200,  3 }, { 198,  37,  3 }, { 198, 201,  3 },
+  { 199,  36,  3 }, { 199, 202,  3 }, { 200,  35,  3 }, { 200, 203,  3 }, { 201,  34,  3 }, { 201, 204,  3 }, { 202,  33,  3 }, { 202, 205,  3 },
+  { 203,  33,  2 }, { 203, 206,  2 }, { 184,  49,  2 }, { 184, 190,  2 }, { 185,  48,  3 }, { 185, 190,  3 }, { 186,  47,  3 }, { 186, 191,  3 },
+  { 187,  46,  3 }, { 187, 192,  3 }, { 188,  45,  3 }, { 188, 193,  3 }, { 189,  44,  3 }, { 189, 194,  3 }, { 190,  43,  2 }, { 190, 196,  2 },
+  { 191,  42,  2 }, { 191, 197,  2 }, { 192,  41,  2 }, { 192, 198,  2 }, { 193,  39,  3 }, { 193, 199,  3 }, { 194,  38,  3 }, { 194, 200,  3 },
+  { 195,  37,  3 }, { 195, 201,  3 }, { 196,  36,  3 }, { 196, 202,  3 }, { 197,  35,  3 }, { 197, 203,  3 }, { 198,  34,  3 }, { 198, 204,  3 },
+  { 199,  33,  3 }, { 199, 205,  3 }, { 200,  32,  3 }, { 200, 206,  3 }, { 201,  31,  3 }, { 201, 207,  3 }, { 202,  32,  1 }, { 202, 208,  1 },
+  { 183,  48,  2 }, { 183, 191,  2 }, { 184,  47,  2 }, { 184, 192,  2 }, { 185,  46,  2 }, { 185, 193,  2 }, { 186,  45,  2 }, { 186, 194,  2 },
+  { 187,  43,  3 }, { 187, 195,  3 }, { 188,  42,  3 }, { 188, 196,  3 }, { 189,  41,  3 }, { 189, 197,  3 }, { 190,  40,  3 }, { 190, 198,  3 },
+  { 191,  39,  3 }, { 191, 199,  3 }, { 192,  38,  3 }, { 192, 200,  3 }, { 193,  37,  2 }, { 193, 202,  2 }, { 194,  35,  3 }, { 194, 203,  3 },
+  { 195,  34,  3 }, { 195, 204,  3 }, { 196,  33,  3 }, { 196, 205,  3 }, { 197,  32,  3 }, { 197, 206,  3 }, { 198,  31,  3 }, { 198, 207,  3 },
+  { 199,  30,  3 }, { 199, 208,  3 }, { 200,  30,  2 }, { 200, 209,  2 }, { 182,  47,  2 }, { 182, 192,  2 }, { 183,  45,  3 }, { 183, 193,  3 },
+  { 184,  44,  3 }, { 184, 194,  3 }, { 185,  43,  3 }, { 185, 195,  3 }, { 186,  42,  3 }, { 186, 196,  3 }, { 187,  41,  2 }, { 187, 198,  2 },
+  { 188,  39,  3 }, { 188, 199,  3 }, { 189,  38,  3 }, { 189, 200,  3 }, { 190,  37,  3 }, { 190, 201,  3 }, { 191,  36,  3 }, { 191, 202,  3 },
+  { 192,  35,  3 }, { 192, 203,  3 }, { 193,  34,  3 }, { 193, 204,  3 }, { 194,  32,  3 }, { 194, 206,  3 }, { 195,  31,  3 }, { 195, 207,  3 },
+  { 196,  30,  3 }, { 196, 208,  3 }, { 197,  29,  3 }, { 197, 209,  3 }, { 198,  29,  2 }, { 198, 210,  2 }, { 180,  46,  1 }, { 180, 194,  1 },
+  { 181,  45,  3 }, { 181, 193,  3 }, { 182,  44,  3 }, { 182, 194,  3 }, { 183,  43,  2 }, { 183, 196,  2 }, { 184,  41,  3 }, { 184, 197,  3 },
+  { 185,  40,  3 }, { 185, 198,  3 }, { 186,  39,  3 }, { 186, 199,  3 }, { 187,  38,  3 }, { 187, 200,  3 }, { 188,  37,  2 }, { 188, 202,  2 },
+  { 189,  35,  3 }, { 189, 203,  3 }, { 190,  34,  3 }, { 190, 204,  3 }, { 191,  33,  3 }, { 191, 205,  3 }, { 192,  32,  3 }, { 192, 206,  3 },
+  { 193,  30,  4 }, { 193, 207,  4 }, { 194,  29,  3 }, { 194, 209,  3 }, { 195,  28,  3 }, { 195, 210,  3 }, { 196,  27,  3 }, { 196, 211,  3 },
+  { 197,  28,  1 }, { 197, 212,  1 }, { 179,  45,  2 }, { 179, 194,  2 }, { 180,  44,  2 }, { 180, 195,  2 }, { 181,  42,  3 }, { 181, 196,  3 },
+  { 182,  41,  3 }, { 182, 197,  3 }, { 183,  40,  3 }, { 183, 198,  3 }, { 184,  39,  2 }, { 184, 200,  2 }, { 185,  37,  3 }, { 185, 201,  3 },
+  { 186,  36,  3 }, { 186, 202,  3 }, { 187,  35,  3 }, { 187, 203,  3 }, { 188,  33,  4 }, { 188, 204,  4 }, { 189,  32,  3 }, { 189, 206,  3 },
+  { 190,  31,  3 }, { 190, 207,  3 }, { 191,  30,  3 }, { 191, 208,  3 }, { 192,  28,  4 }, { 192, 209,  4 }, { 193,  27,  3 }, { 193, 211,  3 },
+  { 194,  26,  3 }, { 194, 212,  3 }, { 195,  26,  2 }, { 195, 213,  2 }, { 178,  44,  2 }, { 178, 195,  2 }, { 179,  42,  3 }, { 179, 196,  3 },
+  { 180,  41,  3 }, { 180, 197,  3 }, { 181,  40,  2 }, { 181, 199,  2 }, { 182,  38,  3 }, { 182, 200,  3 }, { 183,  37,  3 }, { 183, 201,  3 },
+  { 184,  36,  3 }, { 184, 202,  3 }, { 185,  34,  3 }, { 185, 204,  3 }, { 186,  33,  3 }, { 186, 205,  3 }, { 187,  32,  3 }, { 187, 206,  3 },
+  { 188,  30,  3 }, { 188, 208,  3 }, { 189,  29,  3 }, { 189, 209,  3 }, { 190,  28,  3 }, { 190, 210,  3 }, { 191,  26,  4 }, { 191, 211,  4 },
+  { 192,  25,  3 }, { 192, 213,  3 }, { 193,  25,  2 }, { 193, 214,  2 }, { 194,  25,  1 }, { 194, 215,  1 }, { 176,  43,  1 }, { 176, 197,  1 },
+  { 177,  42,  3 }, { 177, 196,  3 }, { 178,  41,  3 }, { 178, 197,  3 }, { 179,  39,  3 }, { 179, 199,  3 }, { 180,  38,  3 }, { 180, 200,  3 },
+  { 181,  37,  3 }, { 181, 201,  3 }, { 182,  35,  3 }, { 182, 203,  3 }, { 183,  34,  3 }, { 183, 204,  3 }, { 184,  32,  4 }, { 184, 205,  4 },
+  { 185,  31,  3 }, { 185, 207,  3 }, { 186,  30,  3 }, { 186, 208,  3 }, { 187,  28,  4 }, { 187, 209,  4 }, { 188,  27,  3 }, { 188, 211,  3 },
+  { 189,  26,  3 }, { 189, 212,  3 }, { 190,  24,  4 }, { 190, 213,  4 }, { 191,  23,  3 }, { 191, 215,  3 }, { 192,  24,  1 }, { 192, 216,  1 },
+  { 175,  42,  2 }, { 175, 197,  2 }, { 176,  41,  2 }, { 176, 198,  2 }, { 177,  39,  3 }, { 177, 199,  3 }, { 178,  38,  3 }, { 178, 200,  3 },
+  { 179,  36,  3 }, { 179, 202,  3 }, { 180,  35,  3 }, { 180, 203,  3 }, { 181,  33,  4 }, { 181, 204,  4 }, { 182,  32,  3 }, { 182, 206,  3 },
+  { 183,  31,  3 }, { 183, 207,  3 }, { 184,  29,  3 }, { 184, 209,  3 }, { 185,  28,  3 }, { 185, 210,  3 }, { 186,  26,  4 }, { 186, 211,  4 },
+  { 187,  25,  3 }, { 187, 213,  3 }, { 188,  23,  4 }, { 188, 214,  4 }, { 189,  22,  4 }, { 189, 215,  4 }, { 190,  22,  2 }, { 190, 217,  2 },
+  { 174,  40,  3 }, { 174, 198,  3 }, { 175,  39,  3 }, { 175, 199,  3 }, { 176,  37,  4 }, { 176, 200,  4 }, { 177,  36,  3 }, { 177, 202,  3 },
+  { 178,  35,  3 }, { 178, 203,  3 }, { 179,  33,  3 }, { 179, 205,  3 }, { 180,  32,  3 }, { 180, 206,  3 }, { 181,  30,  3 }, { 181, 208,  3 },
+  { 182,  29,  3 }, { 182, 209,  3 }, { 183,  27,  4 }, { 183, 210,  4 }, { 184,  26,  3 }, { 184, 212,  3 }, { 185,  24,  4 }, { 185, 213,  4 },
+  { 186,  23,  3 }, { 186, 215,  3 }, { 187,  21,  4 }, { 187, 216,  4 }, { 188,  21,  2 }, { 188, 218,  2 }, { 172,  40,  2 }, { 172, 199,  2 },
+  { 173,  39,  3 }, { 173, 199,  3 }, { 174,  37,  3 }, { 174, 201,  3 }, { 175,  36,  3 }, { 175, 202,  3 }, { 176,  34,  3 }, { 176, 204,  3 },
+  { 177,  33,  3 }, { 177, 205,  3 }, { 178,  31,  4 }, { 178, 206,  4 }, { 179,  30,  3 }, { 179, 208,  3 }, { 180,  28,  4 }, { 180, 209,  4 },
+  { 181,  27,  3 }, { 181, 211,  3 }, { 182,  25,  4 }, { 182, 212,  4 }, { 183,  23,  4 }, { 183, 214,  4 }, { 184,  22,  4 }, { 184, 215,  4 },
+  { 185,  20,  4 }, { 185, 217,  4 }, { 186,  20,  3 }, { 186, 218,  3 }, { 187,  20,  1 }, { 187, 220,  1 }, { 171,  39,  2 }, { 171, 200,  2 },
+  { 172,  37,  3 }, { 172, 201,  3 }, { 173,  36,  3 }, { 173, 202,  3 }, { 174,  34,  3 }, { 174, 204,  3 }, { 175,  32,  4 }, { 175, 205,  4 },
+  { 176,  31,  3 }, { 176, 207,  3 }, { 177,  29,  4 }, { 177, 208,  4 }, { 178,  28,  3 }, { 178, 210,  3 }, { 179,  26,  4 }, { 179, 211,  4 },
+  { 180,  24,  4 }, { 180, 213,  4 }, { 181,  23,  4 }, { 181, 214,  4 }, { 182,  21,  4 }, { 182, 216,  4 }, { 183,  20,  3 }, { 183, 218,  3 },
+  { 184,  18,  4 }, { 184, 219,  4 }, { 185,  19,  1 }, { 185, 221,  1 }, { 169,  39,  1 }, { 169, 201,  1 }, { 170,  37,  3 }, { 170, 201,  3 },
+  { 171,  36,  3 }, { 171, 202,  3 }, { 172,  34,  3 }, { 172, 204,  3 }, { 173,  32,  4 }, { 173, 205,  4 }, { 174,  31,  3 }, { 174, 207,  3 },
+  { 175,  29,  3 }, { 175, 209,  3 }, { 176,  27,  4 }, { 176, 210,  4 }, { 177,  26,  3 }, { 177, 212,  3 }, { 178,  24,  4 }, { 178, 213,  4 },
+  { 179,  22,  4 }, { 179, 215,  4 }, { 180,  21,  3 }, { 180, 217,  3 }, { 181,  19,  4 }, { 181, 218,  4 }, { 182,  17,  4 }, { 182, 220,  4 },
+  { 183,  18,  2 }, { 183, 221,  2 }, { 168,  37,  2 }, { 168, 202,  2 }, { 169,  36,  3 }, { 169, 202,  3 }, { 170,  34,  3 }, { 170, 204,  3 },
+  { 171,  32,  4 }, { 171, 205,  4 }, { 172,  30,  4 }, { 172, 207,  4 }, { 173,  29,  3 }, { 173, 209,  3 }, { 174,  27,  4 }, { 174, 210,  4 },
+  { 175,  25,  4 }, { 175, 212,  4 }, { 176,  24,  3 }, { 176, 214,  3 }, { 177,  22,  4 }, { 177, 215,  4 }, { 178,  20,  4 }, { 178, 217,  4 },
+  { 179,  18,  4 }, { 179, 219,  4 }, { 180,  17,  4 }, { 180, 220,  4 }, { 181,  17,  2 }, { 181, 222,  2 }, { 167,  36,  3 }, { 167, 202,  3 },
+  { 168,  34,  3 }, { 168, 204,  3 }, { 169,  32,  4 }, { 169, 205,  4 }, { 170,  30,  4 }, { 170, 207,  4 }, { 171,  28,  4 }, { 171, 209,  4 },
+  { 172,  27,  3 }, { 172, 211,  3 }, { 173,  25,  4 }, { 173, 212,  4 }, { 174,  23,  4 }, { 174, 214,  4 }, { 175,  21,  4 }, { 175, 216,  4 },
+  { 176,  19,  5 }, { 176, 217,  5 }, { 177,  18,  4 }, { 177, 219,  4 }, { 178,  16,  4 }, { 178, 221,  4 }, { 179,  15,  3 }, { 179, 223,  3 },
+  { 180,  16,  1 }, { 180, 224,  1 }, { 165,  36,  1 }, { 165, 204,  1 }, { 166,  34,  4 }, { 166, 203,  4 }, { 167,  32,  4 }, { 167, 205,  4 },
+  { 168,  30,  4 }, { 168, 207,  4 }, { 169,  28,  4 }, { 169, 209,  4 }, { 170,  26,  4 }, { 170, 211,  4 }, { 171,  25,  3 }, { 171, 213,  3 },
+  { 172,  23,  4 }, { 172, 214,  4 }, { 173,  21,  4 }, { 173, 216,  4 }, { 174,  19,  4 }, { 174, 218,  4 }, { 175,  17,  4 }, { 175, 220,  4 },
+  { 176,  15,  4 }, { 176, 222,  4 }, { 177,  14,  4 }, { 177, 223,  4 }, { 178,  15,  1 }, { 178, 225,  1 }, { 164,  34,  3 }, { 164, 204,  3 },
+  { 165,  32,  4 }, { 165, 205,  4 }, { 166,  30,  4 }, { 166, 207,  4 }, { 167,  28,  4 }, { 167, 209,  4 }, { 168,  26,  4 }, { 168, 211,  4 },
+  { 169,  24,  4 }, { 169, 213,  4 }, { 170,  22,  4 }, { 170, 215,  4 }, { 171,  20,  5 }, { 171, 216,  5 }, { 172,  18,  5 }, { 172, 218,  5 },
+  { 173,  16,  5 }, { 173, 220,  5 }, { 174,  15,  4 }, { 174, 222,  4 }, { 175,  13,  4 }, { 175, 224,  4 }, { 176,  14,  1 }, { 176, 226,  1 },
+  { 162,  34,  2 }, { 162, 205,  2 }, { 163,  32,  4 }, { 163, 205,  4 }, { 164,  30,  4 }, { 164, 207,  4 }, { 165,  28,  4 }, { 165, 209,  4 },
+  { 166,  26,  4 }, { 166, 211,  4 }, { 167,  24,  4 }, { 167, 213,  4 }, { 168,  22,  4 }, { 168, 215,  4 }, { 169,  20,  4 }, { 169, 217,  4 },
+  { 170,  18,  4 }, { 170, 219,  4 }, { 171,  16,  4 }, { 171, 221,  4 }, { 172,  14,  4 }, { 172, 223,  4 }, { 173,  12,  4 }, { 173, 225,  4 },
+  { 174,  13,  2 }, { 174, 226,  2 }, { 161,  33,  2 }, { 161, 206,  2 }, { 162,  30,  4 }, { 162, 207,  4 }, { 163,  28,  4 }, { 163, 209,  4 },
+  { 164,  26,  4 }, { 164, 211,  4 }, { 165,  24,  4 }, { 165, 213,  4 }, { 166,  22,  4 }, { 166, 215,  4 }, { 167,  20,  4 }, { 167, 217,  4 },
+  { 168,  18,  4 }, { 168, 219,  4 }, { 169,  15,  5 }, { 169, 221,  5 }, { 170,  13,  5 }, { 170, 223,  5 }, { 171,  11,  5 }, { 171, 225,  5 },
+  { 172,  12,  2 }, { 172, 227,  2 }, { 159,  33,  1 }, { 159, 207,  1 }, { 160,  31,  4 }, { 160, 206,  4 }, { 161,  28,  5 }, { 161, 208,  5 },
+  { 162,  26,  4 }, { 162, 211,  4 }, { 163,  24,  4 }, { 163, 213,  4 }, { 164,  22,  4 }, { 164, 215,  4 }, { 165,  19,  5 }, { 165, 217,  5 },
+  { 166,  17,  5 }, { 166, 219,  5 }, { 167,  15,  5 }, { 167, 221,  5 }, { 168,  13,  5 }, { 168, 223,  5 }, { 169,  10,  5 }, { 169, 226,  5 },
+  { 170,  11,  2 }, { 170, 228,  2 }, { 157,  33,  1 }, { 157, 207,  1 }, { 158,  31,  3 }, { 158, 207,  3 }, { 159,  29,  4 }, { 159, 208,  4 },
+  { 160,  26,  5 }, { 160, 210,  5 }, { 161,  24,  4 }, { 161, 213,  4 }, { 162,  22,  4 }, { 162, 215,  4 }, { 163,  19,  5 }, { 163, 217,  5 },
+  { 164,  17,  5 }, { 164, 219,  5 }, { 165,  14,  5 }, { 165, 222,  5 }, { 166,  12,  5 }, { 166, 224,  5 }, { 167,  10,  5 }, { 167, 226,  5 },
+  { 168,  10,  3 }, { 168, 228,  3 }, { 156,  31,  2 }, { 156, 208,  2 }, { 157,  29,  4 }, { 157, 208,  4 }, { 158,  26,  5 }, { 158, 210,  5 },
+  { 159,  24,  5 }, { 159, 212,  5 }, { 160,  21,  5 }, { 160, 215,  5 }, { 161,  19,  5 }, { 161, 217,  5 }, { 162,  17,  5 }, { 162, 219,  5 },
+  { 163,  14,  5 }, { 163, 222,  5 }, { 164,  12,  5 }, { 164, 224,  5 }, { 165,   9,  5 }, { 165, 227,  5 }, { 166,   9,  3 }, { 166, 229,  3 },
+  { 155,  29,  4 }, { 155, 208,  4 }, { 156,  27,  4 }, { 156, 210,  4 }, { 157,  24,  5 }, { 157, 212,  5 }, { 158,  22,  4 }, { 158, 215,  4 },
+  { 159,  19,  5 }, { 159, 217,  5 }, { 160,  16,  5 }, { 160, 220,  5 }, { 161,  14,  5 }, { 161, 222,  5 }, { 162,  11,  6 }, { 162, 224,  6 },
+  { 163,   8,  6 }, { 163, 227,  6 }, { 164,   8,  4 }, { 164, 229,  4 }, { 153,  30,  2 }, { 153, 209,  2 }, { 154,  27,  5 }, { 154, 209,  5 },
+  { 155,  24,  5 }, { 155, 212,  5 }, { 156,  22,  5 }, { 156, 214,  5 }, { 157,  19,  5 }, { 157, 217,  5 }, { 158,  16,  6 }, { 158, 219,  6 },
+  { 159,  13,  6 }, { 159, 222,  6 }, { 160,  11,  5 }, { 160, 225,  5 }, { 161,   8,  6 }, { 161, 227,  6 }, { 162,   8,  3 }, { 162, 230,  3 },
+  { 151,  30,  1 }, { 151, 210,  1 }, { 152,  28,  4 }, { 152, 209,  4 }, { 153,  25,  5 }, { 153, 211,  5 }, { 154,  22,  5 }, { 154, 214,  5 },
+  { 155,  19,  5 }, { 155, 217,  5 }, { 156,  16,  6 }, { 156, 219,  6 }, { 157,  13,  6 }, { 157, 222,  6 }, { 158,  10,  6 }, { 158, 225,  6 },
+  { 159,   7,  6 }, { 159, 228,  6 }, { 160,   7,  4 }, { 160, 230,  4 }, { 161,   7,  1 }, { 161, 233,  1 }, { 150,  28,  3 }, { 150, 210,  3 },
+  { 151,  25,  5 }, { 151, 211,  5 }, { 152,  22,  6 }, { 152, 213,  6 }, { 153,  19,  6 }, { 153, 216,  6 }, { 154,  16,  6 }, { 154, 219,  6 },
+  { 155,  13,  6 }, { 155, 222,  6 }, { 156,  10,  6 }, { 156, 225,  6 }, { 157,   7,  6 }, { 157, 228,  6 }, { 158,   6,  4 }, { 158, 231,  4 },
+  { 159,   6,  1 }, { 159, 234,  1 }, { 148,  29,  1 }, { 148, 211,  1 }, { 149,  26,  5 }, { 149, 210,  5 }, { 150,  22,  6 }, { 150, 213,  6 },
+  { 151,  19,  6 }, { 151, 216,  6 }, { 152,  16,  6 }, { 152, 219,  6 }, { 153,  13,  6 }, { 153, 222,  6 }, { 154,   9,  7 }, { 154, 225,  7 },
+  { 155,   6,  7 }, { 155, 228,  7 }, { 156,   6,  4 }, { 156, 231,  4 }, { 157,   6,  1 }, { 157, 234,  1 }, { 147,  26,  4 }, { 147, 211,  4 },
+  { 148,  23,  6 }, { 148, 212,  6 }, { 149,  19,  7 }, { 149, 215,  7 }, { 150,  16,  6 }, { 150, 219,  6 }, { 151,  12,  7 }, { 151, 222,  7 },
+  { 152,   9,  7 }, { 152, 225,  7 }, { 153,   5,  8 }, { 153, 228,  8 }, { 154,   5,  4 }, { 154, 232,  4 }, { 155,   5,  1 }, { 155, 235,  1 },
+  { 145,  27,  2 }, { 145, 212,  2 }, { 146,  23,  7 }, { 146, 211,  7 }, { 147,  20,  6 }, { 147, 215,  6 }, { 148,  16,  7 }, { 148, 218,  7 },
+  { 149,  12,  7 }, { 149, 222,  7 }, { 150,   9,  7 }, { 150, 225,  7 }, { 151,   5,  7 }, { 151, 229,  7 }, { 152,   4,  5 }, { 152, 232,  5 },
+  { 143,  28,  1 }, { 143, 212,  1 }, { 144,  24,  5 }, { 144, 212,  5 }, { 145,  20,  7 }, { 145, 214,  7 }, { 146,  16,  7 }, { 146, 218,  7 },
+  { 147,  12,  8 }, { 147, 221,  8 }, { 148,   8,  8 }, { 148, 225,  8 }, { 149,   4,  8 }, { 149, 229,  8 }, { 150,   4,  5 }, { 150, 232,  5 },
+  { 151,   4,  1 }, { 151, 236,  1 }, { 142,  25,  4 }, { 142, 212,  4 }, { 143,  21,  7 }, { 143, 213,  7 }, { 144,  17,  7 }, { 144, 217,  7 },
+  { 145,  12,  8 }, { 145, 221,  8 }, { 146,   8,  8 }, { 146, 225,  8 }, { 147,   4,  8 }, { 147, 229,  8 }, { 148,   3,  5 }, { 148, 233,  5 },
+  { 140,  26,  2 }, { 140, 213,  2 }, { 141,  22,  6 }, { 141, 213,  6 }, { 142,  17,  8 }, { 142, 216,  8 }, { 143,  12,  9 }, { 143, 220,  9 },
+  { 144,   8,  9 }, { 144, 224,  9 }, { 145,   3,  9 }, { 145, 229,  9 }, { 146,   3,  5 }, { 146, 233,  5 }, { 147,   3,  1 }, { 147, 237,  1 },
+  { 139,  23,  5 }, { 139, 213,  5 }, { 140,  18,  8 }, { 140, 215,  8 }, { 141,  12, 10 }, { 141, 219, 10 }, { 142,   7, 10 }, { 142, 224, 10 },
+  { 143,   2, 10 }, { 143, 229, 10 }, { 144,   2,  6 }, { 144, 233,  6 }, { 137,  24,  4 }, { 137, 213,  4 }, { 138,  18, 10 }, { 138, 213, 10 },
+  { 139,  13, 10 }, { 139, 218, 10 }, { 140,   7, 11 }, { 140, 223, 11 }, { 141,   2, 10 }, { 141, 229, 10 }, { 142,   2,  5 }, { 142, 234,  5 },
+  { 135,  26,  1 }, { 135, 214,  1 }, { 136,  19,  8 }, { 136, 214,  8 }, { 137,  13, 11 }, { 137, 217, 11 }, { 138,   7, 11 }, { 138, 223, 11 },
+  { 139,   2, 11 }, { 139, 228, 11 }, { 140,   2,  5 }, { 140, 234,  5 }, { 134,  21,  6 }, { 134, 214,  6 }, { 135,  14, 12 }, { 135, 215, 12 },
+  { 136,   7, 12 }, { 136, 222, 12 }, { 137,   1, 12 }, { 137, 228, 12 }, { 138,   1,  6 }, { 138, 234,  6 }, { 132,  23,  4 }, { 132, 214,  4 },
+  { 133,  15, 12 }, { 133, 214, 12 }, { 134,   6, 15 }, { 134, 220, 15 }, { 135,   1, 13 }, { 135, 227, 13 }, { 136,   1,  6 }, { 136, 234,  6 },
+  { 130,  25,  2 }, { 130, 214,  2 }, { 131,  16, 11 }, { 131, 214, 11 }, { 132,   6, 17 }, { 132, 218, 17 }, { 133,   1, 14 }, { 133, 226, 14 },
+  { 134,   1,  5 }, { 134, 235,  5 }, { 129,  18,  8 }, { 129, 215,  8 }, { 130,   6, 19 }, { 130, 216, 19 }, { 131,   1, 15 }, { 131, 225, 15 },
+  { 132,   1,  5 }, { 132, 235,  5 }, { 127,  20,  6 }, { 127, 215,  6 }, { 128,   6, 20 }, { 128, 215, 20 }, { 129,   0, 18 }, { 129, 223, 17 },
+  { 130,   0,  6 }, { 130, 235,  5 }, { 125,  25,  1 }, { 125, 215,  1 }, { 126,   6, 20 }, { 126, 215, 20 }, { 127,   0, 20 }, { 127, 221, 19 },
+  { 128,   0,  6 }, { 128, 235,  5 }, { 124,   6, 20 }, { 124, 215, 20 }, { 125,   0, 25 }, { 125, 216, 24 }, { 126,   0,  6 }, { 126, 235,  5 },
+  { 122,   6, 20 }, { 122, 215, 20 }, { 123,   0, 26 }, { 123, 215, 25 }, { 124,   0,  6 }, { 124, 235,  5 }, { 120, 215, 25 }, { 121,   0, 26 },
+  { 121, 215, 25 }, { 122,   0,  6 }, { 122, 235,  5 }, { 118,   0,  6 }, { 118, 235,  5 }, { 119,   0, 26 }, { 119, 215, 25 }, { 120,   0, 26 },
+  { 116,   0,  6 }, { 116, 235,  5 }, { 117,   0, 26 }, { 117, 215, 25 }, { 118,   6, 20 }, { 118, 215, 20 }, { 114,   0,  6 }, { 114, 235,  5 },
+  { 115,   0, 25 }, { 115, 216, 24 }, { 116,   6, 20 }, { 116, 215, 20 }, { 112,   0,  6 }, { 112, 235,  5 }, { 113,   0, 20 }, { 113, 221, 19 },
+  { 114,   6, 20 }, { 114, 215, 20 }, { 115,  25,  1 }, { 115, 215,  1 }, { 110,   0,  6 }, { 110, 235,  5 }, { 111,   0, 18 }, { 111, 223, 17 },
+  { 112,   6, 20 }, { 112, 215, 20 }, { 113,  20,  6 }, { 113, 215,  6 }, { 108,   1,  5 }, { 108, 235,  5 }, { 109,   1, 15 }, { 109, 225, 15 },
+  { 110,   6, 19 }, { 110, 216, 19 }, { 111,  18,  8 }, { 111, 215,  8 }, { 106,   1,  5 }, { 106, 235,  5 }, { 107,   1, 14 }, { 107, 226, 14 },
+  { 108,   6, 17 }, { 108, 218, 17 }, { 109,  16, 11 }, { 109, 214, 11 }, { 110,  25,  2 }, { 110, 214,  2 }, { 104,   1,  6 }, { 104, 234,  6 },
+  { 105,   1, 13 }, { 105, 227, 13 }, { 106,   6, 15 }, { 106, 220, 15 }, { 107,  15, 12 }, { 107, 214, 12 }, { 108,  23,  4 }, { 108, 214,  4 },
+  { 102,   1,  6 }, { 102, 234,  6 }, { 103,   1, 12 }, { 103, 228, 12 }, { 104,   7, 12 }, { 104, 222, 12 }, { 105,  14, 12 }, { 105, 215, 12 },
+  { 106,  21,  6 }, { 106, 214,  6 }, { 100,   2,  5 }, { 100, 234,  5 }, { 101,   2, 11 }, { 101, 228, 11 }, { 102,   7, 11 }, { 102, 223, 11 },
+  { 103,  13, 11 }, { 103, 217, 11 }, { 104,  19,  8 }, { 104, 214,  8 }, { 105,  26,  1 }, { 105, 214,  1 }, {  98,   2,  5 }, {  98, 234,  5 },
+  {  99,   2, 10 }, {  99, 229, 10 }, { 100,   7, 11 }, { 100, 223, 11 }, { 101,  13, 10 }, { 101, 218, 10 }, { 102,  18, 10 }, { 102, 213, 10 },
+  { 103,  24,  4 }, { 103, 213,  4 }, {  96,   2,  6 }, {  96, 233,  6 }, {  97,   2, 10 }, {  97, 229, 10 }, {  98,   7, 10 }, {  98, 224, 10 },
+  {  99,  12, 10 }, {  99, 219, 10 }, { 100,  18,  8 }, { 100, 215,  8 }, { 101,  23,  5 }, { 101, 213,  5 }, {  93,   3,  1 }, {  93, 237,  1 },
+  {  94,   3,  5 }, {  94, 233,  5 }, {  95,   3,  9 }, {  95, 229,  9 }, {  96,   8,  9 }, {  96, 224,  9 }, {  97,  12,  9 }, {  97, 220,  9 },
+  {  98,  17,  8 }, {  98, 216,  8 }, {  99,  22,  6 }, {  99, 213,  6 }, { 100,  26,  2 }, { 100, 213,  2 }, {  92,   3,  5 }, {  92, 233,  5 },
+  {  93,   4,  8 }, {  93, 229,  8 }, {  94,   8,  8 }, {  94, 225,  8 }, {  95,  12,  8 }, {  95, 221,  8 }, {  96,  17,  7 }, {  96, 217,  7 },
+  {  97,  21,  7 }, {  97, 213,  7 }, {  98,  25,  4 }, {  98, 212,  4 }, {  89,   4,  1 }, {  89, 236,  1 }, {  90,   4,  5 }, {  90, 232,  5 },
+  {  91,   4,  8 }, {  91, 229,  8 }, {  92,   8,  8 }, {  92, 225,  8 }, {  93,  12,  8 }, {  93, 221,  8 }, {  94,  16,  7 }, {  94, 218,  7 },
+  {  95,  20,  7 }, {  95, 214,  7 }, {  96,  24,  5 }, {  96, 212,  5 }, {  97,  28,  1 }, {  97, 212,  1 }, {  88,   4,  5 }, {  88, 232,  5 },
+  {  89,   5,  7 }, {  89, 229,  7 }, {  90,   9,  7 }, {  90, 225,  7 }, {  91,  12,  7 }, {  91, 222,  7 }, {  92,  16,  7 }, {  92, 218,  7 },
+  {  93,  20,  6 }, {  93, 215,  6 }, {  94,  23,  7 }, {  94, 211,  7 }, {  95,  27,  2 }, {  95, 212,  2 }, {  85,   5,  1 }, {  85, 235,  1 },
+  {  86,   5,  4 }, {  86, 232,  4 }, {  87,   5,  8 }, {  87, 228,  8 }, {  88,   9,  7 }, {  88, 225,  7 }, {  89,  12,  7 }, {  89, 222,  7 },
+  {  90,  16,  6 }, {  90, 219,  6 }, {  91,  19,  7 }, {  91, 215,  7 }, {  92,  23,  6 }, {  92, 212,  6 }, {  93,  26,  4 }, {  93, 211,  4 },
+  {  83,   6,  1 }, {  83, 234,  1 }, {  84,   6,  4 }, {  84, 231,  4 }, {  85,   6,  7 }, {  85, 228,  7 }, {  86,   9,  7 }, {  86, 225,  7 },
+  {  87,  13,  6 }, {  87, 222,  6 }, {  88,  16,  6 }, {  88, 219,  6 }, {  89,  19,  6 }, {  89, 216,  6 }, {  90,  22,  6 }, {  90, 213,  6 },
+  {  91,  26,  5 }, {  91, 210,  5 }, {  92,  29,  1 }, {  92, 211,  1 }, {  81,   6,  1 }, {  81, 234,  1 }, {  82,   6,  4 }, {  82, 231,  4 },
+  {  83,   7,  6 }, {  83, 228,  6 }, {  84,  10,  6 }, {  84, 225,  6 }, {  85,  13,  6 }, {  85, 222,  6 }, {  86,  16,  6 }, {  86, 219,  6 },
+  {  87,  19,  6 }, {  87, 216,  6 }, {  88,  22,  6 }, {  88, 213,  6 }, {  89,  25,  5 }, {  89, 211,  5 }, {  90,  28,  3 }, {  90, 210,  3 },
+  {  79,   7,  1 }, {  79, 233,  1 }, {  80,   7,  4 }, {  80, 230,  4 }, {  81,   7,  6 }, {  81, 228,  6 }, {  82,  10,  6 }, {  82, 225,  6 },
+  {  83,  13,  6 }, {  83, 222,  6 }, {  84,  16,  6 }, {  84, 219,  6 }, {  85,  19,  5 }, {  85, 217,  5 }, {  86,  22,  5 }, {  86, 214,  5 },
+  {  87,  25,  5 }, {  87, 211,  5 }, {  88,  28,  4 }, {  88, 209,  4 }, {  89,  30,  1 }, {  89, 210,  1 }, {  78,   8,  3 }, {  78, 230,  3 },
+  {  79,   8,  6 }, {  79, 227,  6 }, {  80,  11,  5 }, {  80, 225,  5 }, {  81,  13,  6 }, {  81, 222,  6 }, {  82,  16,  6 }, {  82, 219,  6 },
+  {  83,  19,  5 }, {  83, 217,  5 }, {  84,  22,  5 }, {  84, 214,  5 }, {  85,  24,  5 }, {  85, 212,  5 }, {  86,  27,  5 }, {  86, 209,  5 },
+  {  87,  30,  2 }, {  87, 209,  2 }, {  76,   8,  4 }, {  76, 229,  4 }, {  77,   8,  6 }, {  77, 227,  6 }, {  78,  11,  6 }, {  78, 224,  6 },
+  {  79,  14,  5 }, {  79, 222,  5 }, {  80,  16,  5 }, {  80, 220,  5 }, {  81,  19,  5 }, {  81, 217,  5 }, {  82,  22,  4 }, {  82, 215,  4 },
+  {  83,  24,  5 }, {  83, 212,  5 }, {  84,  27,  4 }, {  84, 210,  4 }, {  85,  29,  4 }, {  85, 208,  4 }, {  74,   9,  3 }, {  74, 229,  3 },
+  {  75,   9,  5 }, {  75, 227,  5 }, {  76,  12,  5 }, {  76, 224,  5 }, {  77,  14,  5 }, {  77, 222,  5 }, {  78,  17,  5 }, {  78, 219,  5 },
+  {  79,  19,  5 }, {  79, 217,  5 }, {  80,  21,  5 }, {  80, 215,  5 }, {  81,  24,  5 }, {  81, 212,  5 }, {  82,  26,  5 }, {  82, 210,  5 },
+  {  83,  29,  4 }, {  83, 208,  4 }, {  84,  31,  2 }, {  84, 208,  2 }, {  72,  10,  3 }, {  72, 228,  3 }, {  73,  10,  5 }, {  73, 226,  5 },
+  {  74,  12,  5 }, {  74, 224,  5 }, {  75,  14,  5 }, {  75, 222,  5 }, {  76,  17,  5 }, {  76, 219,  5 }, {  77,  19,  5 }, {  77, 217,  5 },
+  {  78,  22,  4 }, {  78, 215,  4 }, {  79,  24,  4 }, {  79, 213,  4 }, {  80,  26,  5 }, {  80, 210,  5 }, {  81,  29,  4 }, {  81, 208,  4 },
+  {  82,  31,  3 }, {  82, 207,  3 }, {  83,  33,  1 }, {  83, 207,  1 }, {  70,  11,  2 }, {  70, 228,  2 }, {  71,  10,  5 }, {  71, 226,  5 },
+  {  72,  13,  5 }, {  72, 223,  5 }, {  73,  15,  5 }, {  73, 221,  5 }, {  74,  17,  5 }, {  74, 219,  5 }, {  75,  19,  5 }, {  75, 217,  5 },
+  {  76,  22,  4 }, {  76, 215,  4 }, {  77,  24,  4 }, {  77, 213,  4 }, {  78,  26,  4 }, {  78, 211,  4 }, {  79,  28,  5 }, {  79, 208,  5 },
+  {  80,  31,  4 }, {  80, 206,  4 }, {  81,  33,  1 }, {  81, 207,  1 }, {  68,  12,  2 }, {  68, 227,  2 }, {  69,  11,  5 }, {  69, 225,  5 },
+  {  70,  13,  5 }, {  70, 223,  5 }, {  71,  15,  5 }, {  71, 221,  5 }, {  72,  18,  4 }, {  72, 219,  4 }, {  73,  20,  4 }, {  73, 217,  4 },
+  {  74,  22,  4 }, {  74, 215,  4 }, {  75,  24,  4 }, {  75, 213,  4 }, {  76,  26,  4 }, {  76, 211,  4 }, {  77,  28,  4 }, {  77, 209,  4 },
+  {  78,  30,  4 }, {  78, 207,  4 }, {  79,  33,  2 }, {  79, 206,  2 }, {  66,  13,  2 }, {  66, 226,  2 }, {  67,  12,  4 }, {  67, 225,  4 },
+  {  68,  14,  4 }, {  68, 223,  4 }, {  69,  16,  4 }, {  69, 221,  4 }, {  70,  18,  4 }, {  70, 219,  4 }, {  71,  20,  4 }, {  71, 217,  4 },
+  {  72,  22,  4 }, {  72, 215,  4 }, {  73,  24,  4 }, {  73, 213,  4 }, {  74,  26,  4 }, {  74, 211,  4 }, {  75,  28,  4 }, {  75, 209,  4 },
+  {  76,  30,  4 }, {  76, 207,  4 }, {  77,  32,  4 }, {  77, 205,  4 }, {  78,  34,  2 }, {  78, 205,  2 }, {  64,  14,  1 }, {  64, 226,  1 },
+  {  65,  13,  4 }, {  65, 224,  4 }, {  66,  15,  4 }, {  66, 222,  4 }, {  67,  16,  5 }, {  67, 220,  5 }, {  68,  18,  5 }, {  68, 218,  5 },
+  {  69,  20,  5 }, {  69, 216,  5 }, {  70,  22,  4 }, {  70, 215,  4 }, {  71,  24,  4 }, {  71, 213,  4 }, {  72,  26,  4 }, {  72, 211,  4 },
+  {  73,  28,  4 }, {  73, 209,  4 }, {  74,  30,  4 }, {  74, 207,  4 }, {  75,  32,  4 }, {  75, 205,  4 }, {  76,  34,  3 }, {  76, 204,  3 },
+  {  62,  15,  1 }, {  62, 225,  1 }, {  63,  14,  4 }, {  63, 223,  4 }, {  64,  15,  4 }, {  64, 222,  4 }, {  65,  17,  4 }, {  65, 220,  4 },
+  {  66,  19,  4 }, {  66, 218,  4 }, {  67,  21,  4 }, {  67, 216,  4 }, {  68,  23,  4 }, {  68, 214,  4 }, {  69,  25,  3 }, {  69, 213,  3 },
+  {  70,  26,  4 }, {  70, 211,  4 }, {  71,  28,  4 }, {  71, 209,  4 }, {  72,  30,  4 }, {  72, 207,  4 }, {  73,  32,  4 }, {  73, 205,  4 },
+  {  74,  34,  4 }, {  74, 203,  4 }, {  75,  36,  1 }, {  75, 204,  1 }, {  60,  16,  1 }, {  60, 224,  1 }, {  61,  15,  3 }, {  61, 223,  3 },
+  {  62,  16,  4 }, {  62, 221,  4 }, {  63,  18,  4 }, {  63, 219,  4 }, {  64,  19,  5 }, {  64, 217,  5 }, {  65,  21,  4 }, {  65, 216,  4 },
+  {  66,  23,  4 }, {  66, 214,  4 }, {  67,  25,  4 }, {  67, 212,  4 }, {  68,  27,  3 }, {  68, 211,  3 }, {  69,  28,  4 }, {  69, 209,  4 },
+  {  70,  30,  4 }, {  70, 207,  4 }, {  71,  32,  4 }, {  71, 205,  4 }, {  72,  34,  3 }, {  72, 204,  3 }, {  73,  36,  3 }, {  73, 202,  3 },
+  {  59,  17,  2 }, {  59, 222,  2 }, {  60,  17,  4 }, {  60, 220,  4 }, {  61,  18,  4 }, {  61, 219,  4 }, {  62,  20,  4 }, {  62, 217,  4 },
+  {  63,  22,  4 }, {  63, 215,  4 }, {  64,  24,  3 }, {  64, 214,  3 }, {  65,  25,  4 }, {  65, 212,  4 }, {  66,  27,  4 }, {  66, 210,  4 },
+  {  67,  29,  3 }, {  67, 209,  3 }, {  68,  30,  4 }, {  68, 207,  4 }, {  69,  32,  4 }, {  69, 205,  4 }, {  70,  34,  3 }, {  70, 204,  3 },
+  {  71,  36,  3 }, {  71, 202,  3 }, {  72,  37,  2 }, {  72, 202,  2 }, {  57,  18,  2 }, {  57, 221,  2 }, {  58,  17,  4 }, {  58, 220,  4 },
+  {  59,  19,  4 }, {  59, 218,  4 }, {  60,  21,  3 }, {  60, 217,  3 }, {  61,  22,  4 }, {  61, 215,  4 }, {  62,  24,  4 }, {  62, 213,  4 },
+  {  63,  26,  3 }, {  63, 212,  3 }, {  64,  27,  4 }, {  64, 210,  4 }, {  65,  29,  3 }, {  65, 209,  3 }, {  66,  31,  3 }, {  66, 207,  3 },
+  {  67,  32,  4 }, {  67, 205,  4 }, {  68,  34,  3 }, {  68, 204,  3 }, {  69,  36,  3 }, {  69, 202,  3 }, {  70,  37,  3 }, {  70, 201,  3 },
+  {  71,  39,  1 }, {  71, 201,  1 }, {  55,  19,  1 }, {  55, 221,  1 }, {  56,  18,  4 }, {  56, 219,  4 }, {  57,  20,  3 }, {  57, 218,  3 },
+  {  58,  21,  4 }, {  58, 216,  4 }, {  59,  23,  4 }, {  59, 214,  4 }, {  60,  24,  4 }, {  60, 213,  4 }, {  61,  26,  4 }, {  61, 211,  4 },
+  {  62,  28,  3 }, {  62, 210,  3 }, {  63,  29,  4 }, {  63, 208,  4 }, {  64,  31,  3 }, {  64, 207,  3 }, {  65,  32,  4 }, {  65, 205,  4 },
+  {  66,  34,  3 }, {  66, 204,  3 }, {  67,  36,  3 }, {  67, 202,  3 }, {  68,  37,  3 }, {  68, 201,  3 }, {  69,  39,  2 }, {  69, 200,  2 },
+  {  53,  20,  1 }, {  53, 220,  1 }, {  54,  20,  3 }, {  54, 218,  3 }, {  55,  20,  4 }, {  55, 217,  4 }, {  56,  22,  4 }, {  56, 215,  4 },
+  {  57,  23,  4 }, {  57, 214,  4 }, {  58,  25,  4 }, {  58, 212,  4 }, {  59,  27,  3 }, {  59, 211,  3 }, {  60,  28,  4 }, {  60, 209,  4 },
+  {  61,  30,  3 }, {  61, 208,  3 }, {  62,  31,  4 }, {  62, 206,  4 }, {  63,  33,  3 }, {  63, 205,  3 }, {  64,  34,  3 }, {  64, 204,  3 },
+  {  65,  36,  3 }, {  65, 202,  3 }, {  66,  37,  3 }, {  66, 201,  3 }, {  67,  39,  3 }, {  67, 199,  3 }, {  68,  40,  2 }, {  68, 199,  2 },
+  {  52,  21,  2 }, {  52, 218,  2 }, {  53,  21,  4 }, {  53, 216,  4 }, {  54,  23,  3 }, {  54, 215,  3 }, {  55,  24,  4 }, {  55, 213,  4 },
+  {  56,  26,  3 }, {  56, 212,  3 }, {  57,  27,  4 }, {  57, 210,  4 }, {  58,  29,  3 }, {  58, 209,  3 }, {  59,  30,  3 }, {  59, 208,  3 },
+  {  60,  32,  3 }, {  60, 206,  3 }, {  61,  33,  3 }, {  61, 205,  3 }, {  62,  35,  3 }, {  62, 203,  3 }, {  63,  36,  3 }, {  63, 202,  3 },
+  {  64,  37,  4 }, {  64, 200,  4 }, {  65,  39,  3 }, {  65, 199,  3 }, {  66,  40,  3 }, {  66, 198,  3 }, {  50,  22,  2 }, {  50, 217,  2 },
+  {  51,  22,  4 }, {  51, 215,  4 }, {  52,  23,  4 }, {  52, 214,  4 }, {  53,  25,  3 }, {  53, 213,  3 }, {  54,  26,  4 }, {  54, 211,  4 },
+  {  55,  28,  3 }, {  55, 210,  3 }, {  56,  29,  3 }, {  56, 209,  3 }, {  57,  31,  3 }, {  57, 207,  3 }, {  58,  32,  3 }, {  58, 206,  3 },
+  {  59,  33,  4 }, {  59, 204,  4 }, {  60,  35,  3 }, {  60, 203,  3 }, {  61,  36,  3 }, {  61, 202,  3 }, {  62,  38,  3 }, {  62, 200,  3 },
+  {  63,  39,  3 }, {  63, 199,  3 }, {  64,  41,  2 }, {  64, 198,  2 }, {  65,  42,  2 }, {  65, 197,  2 }, {  48,  24,  1 }, {  48, 216,  1 },
+  {  49,  23,  3 }, {  49, 215,  3 }, {  50,  24,  4 }, {  50, 213,  4 }, {  51,  26,  3 }, {  51, 212,  3 }, {  52,  27,  3 }, {  52, 211,  3 },
+  {  53,  28,  4 }, {  53, 209,  4 }, {  54,  30,  3 }, {  54, 208,  3 }, {  55,  31,  3 }, {  55, 207,  3 }, {  56,  32,  4 }, {  56, 205,  4 },
+  {  57,  34,  3 }, {  57, 204,  3 }, {  58,  35,  3 }, {  58, 203,  3 }, {  59,  37,  3 }, {  59, 201,  3 }, {  60,  38,  3 }, {  60, 200,  3 },
+  {  61,  39,  3 }, {  61, 199,  3 }, {  62,  41,  3 }, {  62, 197,  3 }, {  63,  42,  3 }, {  63, 196,  3 }, {  64,  43,  1 }, {  64, 197,  1 },
+  {  46,  25,  1 }, {  46, 215,  1 }, {  47,  25,  2 }, {  47, 214,  2 }, {  48,  25,  3 }, {  48, 213,  3 }, {  49,  26,  4 }, {  49, 211,  4 },
+  {  50,  28,  3 }, {  50, 210,  3 }, {  51,  29,  3 }, {  51, 209,  3 }, {  52,  30,  3 }, {  52, 208,  3 }, {  53,  32,  3 }, {  53, 206,  3 },
+  {  54,  33,  3 }, {  54, 205,  3 }, {  55,  34,  3 }, {  55, 204,  3 }, {  56,  36,  3 }, {  56, 202,  3 }, {  57,  37,  3 }, {  57, 201,  3 },
+  {  58,  38,  3 }, {  58, 200,  3 }, {  59,  40,  2 }, {  59, 199,  2 }, {  60,  41,  3 }, {  60, 197,  3 }, {  61,  42,  3 }, {  61, 196,  3 },
+  {  62,  44,  2 }, {  62, 195,  2 }, {  45,  26,  2 }, {  45, 213,  2 }, {  46,  26,  3 }, {  46, 212,  3 }, {  47,  27,  3 }, {  47, 211,  3 },
+  {  48,  28,  4 }, {  48, 209,  4 }, {  49,  30,  3 }, {  49, 208,  3 }, {  50,  31,  3 }, {  50, 207,  3 }, {  51,  32,  3 }, {  51, 206,  3 },
+  {  52,  33,  4 }, {  52, 204,  4 }, {  53,  35,  3 }, {  53, 203,  3 }, {  54,  36,  3 }, {  54, 202,  3 }, {  55,  37,  3 }, {  55, 201,  3 },
+  {  56,  39,  2 }, {  56, 200,  2 }, {  57,  40,  3 }, {  57, 198,  3 }, {  58,  41,  3 }, {  58, 197,  3 }, {  59,  42,  3 }, {  59, 196,  3 },
+  {  60,  44,  2 }, {  60, 195,  2 }, {  61,  45,  2 }, {  61, 194,  2 }, {  43,  28,  1 }, {  43, 212,  1 }, {  44,  27,  3 }, {  44, 211,  3 },
+  {  45,  28,  3 }, {  45, 210,  3 }, {  46,  29,  3 }, {  46, 209,  3 }, {  47,  30,  4 }, {  47, 207,  4 }, {  48,  32,  3 }, {  48, 206,  3 },
+  {  49,  33,  3 }, {  49, 205,  3 }, {  50,  34,  3 }, {  50, 204,  3 }, {  51,  35,  3 }, {  51, 203,  3 }, {  52,  37,  2 }, {  52, 202,  2 },
+  {  53,  38,  3 }, {  53, 200,  3 }, {  54,  39,  3 }, {  54, 199,  3 }, {  55,  40,  3 }, {  55, 198,  3 }, {  56,  41,  3 }, {  56, 197,  3 },
+  {  57,  43,  2 }, {  57, 196,  2 }, {  58,  44,  3 }, {  58, 194,  3 }, {  59,  45,  3 }, {  59, 193,  3 }, {  60,  46,  1 }, {  60, 194,  1 },
+  {  42,  29,  2 }, {  42, 210,  2 }, {  43,  29,  3 }, {  43, 209,  3 }, {  44,  30,  3 }, {  44, 208,  3 }, {  45,  31,  3 }, {  45, 207,  3 },
+  {  46,  32,  3 }, {  46, 206,  3 }, {  47,  34,  3 }, {  47, 204,  3 }, {  48,  35,  3 }, {  48, 203,  3 }, {  49,  36,  3 }, {  49, 202,  3 },
+  {  50,  37,  3 }, {  50, 201,  3 }, {  51,  38,  3 }, {  51, 200,  3 }, {  52,  39,  3 }, {  52, 199,  3 }, {  53,  41,  2 }, {  53, 198,  2 },
+  {  54,  42,  3 }, {  54, 196,  3 }, {  55,  43,  3 }, {  55, 195,  3 }, {  56,  44,  3 }, {  56, 194,  3 }, {  57,  45,  3 }, {  57, 193,  3 },
+  {  58,  47,  2 }, {  58, 192,  2 }, {  40,  30,  2 }, {  40, 209,  2 }, {  41,  30,  3 }, {  41, 208,  3 }, {  42,  31,  3 }, {  42, 207,  3 },
+  {  43,  32,  3 }, {  43, 206,  3 }, {  44,  33,  3 }, {  44, 205,  3 }, {  45,  34,  3 }, {  45, 204,  3 }, {  46,  35,  3 }, {  46, 203,  3 },
+  {  47,  37,  2 }, {  47, 202,  2 }, {  48,  38,  3 }, {  48, 200,  3 }, {  49,  39,  3 }, {  49, 199,  3 }, {  50,  40,  3 }, {  50, 198,  3 },
+  {  51,  41,  3 }, {  51, 197,  3 }, {  52,  42,  3 }, {  52, 196,  3 }, {  53,  43,  3 }, {  53, 195,  3 }, {  54,  45,  2 }, {  54, 194,  2 },
+  {  55,  46,  2 }, {  55, 193,  2 }, {  56,  47,  2 }, {  56, 192,  2 }, {  57,  48,  2 }, {  57, 191,  2 }, {  38,  32,  1 }, {  38, 208,  1 },
+  {  39,  31,  3 }, {  39, 207,  3 }, {  40,  32,  3 }, {  40, 206,  3 }, {  41,  33,  3 }, {  41, 205,  3 }, {  42,  34,  3 }, {  42, 204,  3 },
+  {  43,  35,  3 }, {  43, 203,  3 }, {  44,  36,  3 }, {  44, 202,  3 }, {  45,  37,  3 }, {  45, 201,  3 }, {  46,  38,  3 }, {  46, 200,  3 },
+  {  47,  39,  3 }, {  47, 199,  3 }, {  48,  41,  2 }, {  48, 198,  2 }, {  49,  42,  2 }, {  49, 197,  2 }, {  50,  43,  2 }, {  50, 196,  2 },
+  {  51,  44,  3 }, {  51, 194,  3 }, {  52,  45,  3 }, {  52, 193,  3 }, {  53,  46,  3 }, {  53, 192,  3 }, {  54,  47,  3 }, {  54, 191,  3 },
+  {  55,  48,  3 }, {  55, 190,  3 }, {  56,  49,  2 }, {  56, 190,  2 }, {  37,  33,  2 }, {  37, 206,  2 }, {  38,  33,  3 }, {  38, 205,  3 },
+  {  39,  34,  3 }, {  39, 204,  3 }, {  40,  35,  3 }, {  40, 203,  3 }, {  41,  36,  3 }, {  41, 202,  3 }, {  42,  37,  3 }, {  42, 201,  3 },
+  {  43,  38,  3 }, {  43, 200,  3 }, {  44,  39,  3 }, {  44, 199,  3 }, {  45,  40,  3 }, {  45, 198,  3 }, {  46,  41,  3 }, {  46, 197,  3 },
+  {  47,  42,  3 }, {  47, 196,  3 }, {  48,  43,  3 }, {  48, 195,  3 }, {  49,  44,  3 }, {  49, 194,  3 }, {  50,  45,  3 }, {  50, 193,  3 },
+  {  51,  47,  2 }, {  51, 192,  2 }, {  52,  48,  2 }, {  52, 191,  2 }, {  53,  49,  2 }, {  53, 190,  2 }, {  54,  50,  2 }, {  54, 189,  2 },
+  {  55,  51,  1 }, {  55, 189,  1 }, {  36,  34,  2 }, {  36, 205,  2 }, {  37,  35,  2 }, {  37, 204,  2 }, {  38,  36,  2 }, {  38, 203,  2 },
+  {  39,  37,  2 }, {  39, 202,  2 }, {  40,  38,  2 }, {  40, 201,  2 }, {  41,  39,  2 }, {  41, 200,  2 }, {  42,  40,  2 }, {  42, 199,  2 },
+  {  43,  41,  2 }, {  43, 198,  2 }, {  44,  42,  2 }, {  44, 197,  2 }, {  45,  43,  2 }, {  45, 196,  2 }, {  46,  44,  2 }, {  46, 195,  2 },
+  {  47,  45,  2 }, {  47, 194,  2 }, {  48,  46,  2 }, {  48, 193,  2 }, {  49,  47,  2 }, {  49, 192,  2 }, {  50,  48,  2 }, {  50, 191,  2 },
+  {  51,  49,  2 }, {  51, 190,  2 }, {  52,  50,  2 }, {  52, 189,  2 }, {  53,  51,  2 }, {  53, 188,  2 }, {  54,  52,  1 }, {  54, 188,  1 },
+  {  34,  36,  1 }, {  34, 204,  1 }, {  35,  35,  3 }, {  35, 203,  3 }, {  36,  36,  3 }, {  36, 202,  3 }, {  37,  37,  3 }, {  37, 201,  3 },
+  {  38,  38,  3 }, {  38, 200,  3 }, {  39,  39,  3 }, {  39, 199,  3 }, {  40,  40,  3 }, {  40, 198,  3 }, {  41,  41,  3 }, {  41, 197,  3 },
+  {  42,  42,  3 }, {  42, 196,  3 }, {  43,  43,  3 }, {  43, 195,  3 }, {  44,  44,  3 }, {  44, 194,  3 }, {  45,  45,  3 }, {  45, 193,  3 },
+  {  46,  46,  3 }, {  46, 192,  3 }, {  47,  47,  3 }, {  47, 191,  3 }, {  48,  48,  3 }, {  48, 190,  3 }, {  49,  49,  3 }, {  49, 189,  3 },
+  {  50,  50,  3 }, {  50, 188,  3 }, {  51,  51,  3 }, {  51, 187,  3 }, {  52,  52,  3 }, {  52, 186,  3 }, {  53,  53,  1 }, {  53, 187,  1 },
+  {  33,  37,  2 }, {  33, 202,  2 }, {  34,  37,  3 }, {  34, 201,  3 }, {  35,  38,  3 }, {  35, 200,  3 }, {  36,  39,  3 }, {  36, 199,  3 },
+  {  37,  40,  3 }, {  37, 198,  3 }, {  38,  41,  3 }, {  38, 197,  3 }, {  39,  42,  3 }, {  39, 196,  3 }, {  40,  43,  3 }, {  40, 195,  3 },
+  {  41,  44,  3 }, {  41, 194,  3 }, {  42,  45,  3 }, {  42, 193,  3 }, {  43,  46,  3 }, {  43, 192,  3 }, {  44,  47,  3 }, {  44, 191,  3 },
+  {  45,  48,  3 }, {  45, 190,  3 }, {  46,  49,  2 }, {  46, 190,  2 }, {  47,  50,  2 }, {  47, 189,  2 }, {  48,  51,  2 }, {  48, 188,  2 },
+  {  49,  52,  2 }, {  49, 187,  2 }, {  50,  53,  2 }, {  50, 186,  2 }, {  51,  54,  2 }, {  51, 185,  2 }, {  31,  39,  1 }, {  31, 201,  1 },
+  {  32,  38,  3 }, {  32, 200,  3 }, {  33,  39,  3 }, {  33, 199,  3 }, {  34,  40,  3 }, {  34, 198,  3 }, {  35,  41,  3 }, {  35, 197,  3 },
+  {  36,  42,  3 }, {  36, 196,  3 }, {  37,  43,  3 }, {  37, 195,  3 }, {  38,  44,  3 }, {  38, 194,  3 }, {  39,  45,  3 }, {  39, 193,  3 },
+  {  40,  46,  2 }, {  40, 193,  2 }, {  41,  47,  2 }, {  41, 192,  2 }, {  42,  48,  2 }, {  42, 191,  2 }, {  43,  49,  2 }, {  43, 190,  2 },
+  {  44,  50,  2 }, {  44, 189,  2 }, {  45,  51,  2 }, {  45, 188,  2 }, {  46,  51,  3 }, {  46, 187,  3 }, {  47,  52,  3 }, {  47, 186,  3 },
+  {  48,  53,  3 }, {  48, 185,  3 }, {  49,  54,  3 }, {  49, 184,  3 }, {  50,  55,  2 }, {  50, 184,  2 }, {  30,  40,  2 }, {  30, 199,  2 },
+  {  31,  40,  3 }, {  31, 198,  3 }, {  32,  41,  3 }, {  32, 197,  3 }, {  33,  42,  3 }, {  33, 196,  3 }, {  34,  43,  3 }, {  34, 195,  3 },
+  {  35,  44,  3 }, {  35, 194,  3 }, {  36,  45,  2 }, {  36, 194,  2 }, {  37,  46,  2 }, {  37, 193,  2 }, {  38,  47,  2 }, {  38, 192,  2 },
+  {  39,  48,  2 }, {  39, 191,  2 }, {  40,  48,  3 }, {  40, 190,  3 }, {  41,  49,  3 }, {  41, 189,  3 }, {  42,  50,  3 }, {  42, 188,  3 },
+  {  43,  51,  3 }, {  43, 187,  3 }, {  44,  52,  2 }, {  44, 187,  2 }, {  45,  53,  2 }, {  45, 186,  2 }, {  46,  54,  2 }, {  46, 185,  2 },
+  {  47,  55,  2 }, {  47, 184,  2 }, {  48,  56,  2 }, {  48, 183,  2 }, {  49,  57,  1 }, {  49, 183,  1 }, {  29,  42,  2 }, {  29, 197,  2 },
+  {  30,  42,  3 }, {  30, 196,  3 }, {  31,  43,  3 }, {  31, 195,  3 }, {  32,  44,  3 }, {  32, 194,  3 }, {  33,  45,  2 }, {  33, 194,  2 },
+  {  34,  46,  2 }, {  34, 193,  2 }, {  35,  47,  2 }, {  35, 192,  2 }, {  36,  47,  3 }, {  36, 191,  3 }, {  37,  48,  3 }, {  37, 190,  3 },
+  {  38,  49,  3 }, {  38, 189,  3 }, {  39,  50,  3 }, {  39, 188,  3 }, {  40,  51,  2 }, {  40, 188,  2 }, {  41,  52,  2 }, {  41, 187,  2 },
+  {  42,  53,  2 }, {  42, 186,  2 }, {  43,  54,  2 }, {  43, 185,  2 }, {  44,  54,  3 }, {  44, 184,  3 }, {  45,  55,  3 }, {  45, 183,  3 },
+  {  46,  56,  2 }, {  46, 183,  2 }, {  47,  57,  2 }, {  47, 182,  2 }, {  48,  58,  1 }, {  48, 182,  1 }, {  27,  44,  1 }, {  27, 196,  1 },
+  {  28,  43,  3 }, {  28, 195,  3 }, {  29,  44,  3 }, {  29, 194,  3 }, {  30,  45,  3 }, {  30, 193,  3 }, {  31,  46,  2 }, {  31, 193,  2 },
+  {  32,  47,  2 }, {  32, 192,  2 }, {  33,  47,  3 }, {  33, 191,  3 }, {  34,  48,  3 }, {  34, 190,  3 }, {  35,  49,  3 }, {  35, 189,  3 },
+  {  36,  50,  2 }, {  36, 189,  2 }, {  37,  51,  2 }, {  37, 188,  2 }, {  38,  52,  2 }, {  38, 187,  2 }, {  39,  53,  2 }, {  39, 186,  2 },
+  {  40,  53,  3 }, {  40, 185,  3 }, {  41,  54,  3 }, {  41, 184,  3 }, {  42,  55,  2 }, {  42, 184,  2 }, {  43,  56,  2 }, {  43, 183,  2 },
+  {  44,  57,  2 }, {  44, 182,  2 }, {  45,  58,  2 }, {  45, 181,  2 }, {  46,  58,  3 }, {  46, 180,  3 }, {  47,  59,  1 }, {  47, 181,  1 },
+  {  26,  45,  2 }, {  26, 194,  2 }, {  27,  45,  3 }, {  27, 193,  3 }, {  28,  46,  3 }, {  28, 192,  3 }, {  29,  47,  2 }, {  29, 192,  2 },
+  {  30,  48,  2 }, {  30, 191,  2 }, {  31,  48,  3 }, {  31, 190,  3 }, {  32,  49,  3 }, {  32, 189,  3 }, {  33,  50,  3 }, {  33, 188,  3 },
+  {  34,  51,  2 }, {  34, 188,  2 }, {  35,  52,  2 }, {  35, 187,  2 }, {  36,  52,  3 }, {  36, 186,  3 }, {  37,  53,  3 }, {  37, 185,  3 },
+  {  38,  54,  2 }, {  38, 185,  2 }, {  39,  55,  2 }, {  39, 184,  2 }, {  40,  56,  2 }, {  40, 183,  2 }, {  41,  57,  2 }, {  41, 182,  2 },
+  {  42,  57,  3 }, {  42, 181,  3 }, {  43,  58,  2 }, {  43, 181,  2 }, {  44,  59,  2 }, {  44, 180,  2 }, {  45,  60,  2 }, {  45, 179,  2 },
+  {  46,  61,  1 }, {  46, 179,  1 }, {  25,  46,  3 }, {  25, 192,  3 }, {  26,  47,  3 }, {  26, 191,  3 }, {  27,  48,  2 }, {  27, 191,  2 },
+  {  28,  49,  2 }, {  28, 190,  2 }, {  29,  49,  3 }, {  29, 189,  3 }, {  30,  50,  3 }, {  30, 188,  3 }, {  31,  51,  2 }, {  31, 188,  2 },
+  {  32,  52,  2 }, {  32, 187,  2 }, {  33,  53,  2 }, {  33, 186,  2 }, {  34,  53,  3 }, {  34, 185,  3 }, {  35,  54,  2 }, {  35, 185,  2 },
+  {  36,  55,  2 }, {  36, 184,  2 }, {  37,  56,  2 }, {  37, 183,  2 }, {  38,  56,  3 }, {  38, 182,  3 }, {  39,  57,  2 }, {  39, 182,  2 },
+  {  40,  58,  2 }, {  40, 181,  2 }, {  41,  59,  2 }, {  41, 180,  2 }, {  42,  60,  2 }, {  42, 179,  2 }, {  43,  60,  2 }, {  43, 179,  2 },
+  {  44,  61,  2 }, {  44, 178,  2 }, {  45,  62,  1 }, {  45, 178,  1 }, {  23,  49,  1 }, {  23, 191,  1 }, {  24,  48,  3 }, {  24, 190,  3 },
+  {  25,  49,  2 }, {  25, 190,  2 }, {  26,  50,  2 }, {  26, 189,  2 }, {  27,  50,  3 }, {  27, 188,  3 }, {  28,  51,  3 }, {  28, 187,  3 },
+  {  29,  52,  2 }, {  29, 187,  2 }, {  30,  53,  2 }, {  30, 186,  2 }, {  31,  53,  3 }, {  31, 185,  3 }, {  32,  54,  3 }, {  32, 184,  3 },
+  {  33,  55,  2 }, {  33, 184,  2 }, {  34,  56,  2 }, {  34, 183,  2 }, {  35,  56,  3 }, {  35, 182,  3 }, {  36,  57,  2 }, {  36, 182,  2 },
+  {  37,  58,  2 }, {  37, 181,  2 }, {  38,  59,  2 }, {  38, 180,  2 }, {  39,  59,  3 }, {  39, 179,  3 }, {  40,  60,  2 }, {  40, 179,  2 },
+  {  41,  61,  2 }, {  41, 178,  2 }, {  42,  62,  2 }, {  42, 177,  2 }, {  43,  62,  3 }, {  43, 176,  3 }, {  44,  63,  1 }, {  44, 177,  1 },
+  {  22,  50,  2 }, {  22, 189,  2 }, {  23,  50,  3 }, {  23, 188,  3 }, {  24,  51,  2 }, {  24, 188,  2 }, {  25,  51,  3 }, {  25, 187,  3 },
+  {  26,  52,  3 }, {  26, 186,  3 }, {  27,  53,  2 }, {  27, 186,  2 }, {  28,  54,  2 }, {  28, 185,  2 }, {  29,  54,  3 }, {  29, 184,  3 },
+  {  30,  55,  2 }, {  30, 184,  2 }, {  31,  56,  2 }, {  31, 183,  2 }, {  32,  57,  2 }, {  32, 182,  2 }, {  33,  57,  3 }, {  33, 181,  3 },
+  {  34,  58,  2 }, {  34, 181,  2 }, {  35,  59,  2 }, {  35, 180,  2 }, {  36,  59,  3 }, {  36, 179,  3 }, {  37,  60,  2 }, {  37, 179,  2 },
+  {  38,  61,  2 }, {  38, 178,  2 }, {  39,  62,  2 }, {  39, 177,  2 }, {  40,  62,  2 }, {  40, 177,  2 }, {  41,  63,  2 }, {  41, 176,  2 },
+  {  42,  64,  2 }, {  42, 175,  2 }, {  43,  65,  1 }, {  43, 175,  1 }, {  21,  52,  2 }, {  21, 187,  2 }, {  22,  52,  2 }, {  22, 187,  2 },
+  {  23,  53,  2 }, {  23, 186,  2 }, {  24,  53,  3 }, {  24, 185,  3 }, {  25,  54,  2 }, {  25, 185,  2 }, {  26,  55,  2 }, {  26, 184,  2 },
+  {  27,  55,  3 }, {  27, 183,  3 }, {  28,  56,  2 }, {  28, 183,  2 }, {  29,  57,  2 }, {  29, 182,  2 }, {  30,  57,  3 }, {  30, 181,  3 },
+  {  31,  58,  2 }, {  31, 181,  2 }, {  32,  59,  2 }, {  32, 180,  2 }, {  33,  60,  2 }, {  33, 179,  2 }, {  34,  60,  2 }, {  34, 179,  2 },
+  {  35,  61,  2 }, {  35, 178,  2 }, {  36,  62,  2 }, {  36, 177,  2 }, {  37,  62,  3 }, {  37, 176,  3 }, {  38,  63,  2 }, {  38, 176,  2 },
+  {  39,  64,  2 }, {  39, 175,  2 }, {  40,  64,  3 }, {  40, 174,  3 }, {  41,  65,  2 }, {  41, 174,  2 }, {  42,  66,  1 }, {  42, 174,  1 },
+  {  20,  53,  3 }, {  20, 185,  3 }, {  21,  54,  2 }, {  21, 185,  2 }, {  22,  54,  3 }, {  22, 184,  3 }, {  23,  55,  3 }, {  23, 183,  3 },
+  {  24,  56,  2 }, {  24, 183,  2 }, {  25,  56,  3 }, {  25, 182,  3 }, {  26,  57,  2 }, {  26, 182,  2 }, {  27,  58,  2 }, {  27, 181,  2 },
+  {  28,  58,  3 }, {  28, 180,  3 }, {  29,  59,  2 }, {  29, 180,  2 }, {  30,  60,  2 }, {  30, 179,  2 }, {  31,  60,  3 }, {  31, 178,  3 },
+  {  32,  61,  2 }, {  32, 178,  2 }, {  33,  62,  2 }, {  33, 177,  2 }, {  34,  62,  3 }, {  34, 176,  3 }, {  35,  63,  2 }, {  35, 176,  2 },
+  {  36,  64,  2 }, {  36, 175,  2 }, {  37,  65,  2 }, {  37, 174,  2 }, {  38,  65,  2 }, {  38, 174,  2 }, {  39,  66,  2 }, {  39, 173,  2 },
+  {  40,  67,  2 }, {  40, 172,  2 }, {  41,  67,  2 }, {  41, 172,  2 }, {  18,  56,  1 }, {  18, 184,  1 }, {  19,  55,  2 }, {  19, 184,  2 },
+  {  20,  56,  2 }, {  20, 183,  2 }, {  21,  56,  3 }, {  21, 182,  3 }, {  22,  57,  2 }, {  22, 182,  2 }, {  23,  58,  2 }, {  23, 181,  2 },
+  {  24,  58,  3 }, {  24, 180,  3 }, {  25,  59,  2 }, {  25, 180,  2 }, {  26,  59,  3 }, {  26, 179,  3 }, {  27,  60,  2 }, {  27, 179,  2 },
+  {  28,  61,  2 }, {  28, 178,  2 }, {  29,  61,  3 }, {  29, 177,  3 }, {  30,  62,  2 }, {  30, 177,  2 }, {  31,  63,  2 }, {  31, 176,  2 },
+  {  32,  63,  3 }, {  32, 175,  3 }, {  33,  64,  2 }, {  33, 175,  2 }, {  34,  65,  2 }, {  34, 174,  2 }, {  35,  65,  2 }, {  35, 174,  2 },
+  {  36,  66,  2 }, {  36, 173,  2 }, {  37,  67,  2 }, {  37, 172,  2 }, {  38,  67,  2 }, {  38, 172,  2 }, {  39,  68,  2 }, {  39, 171,  2 },
+  {  40,  69,  1 }, {  40, 171,  1 }, {  17,  58,  1 }, {  17, 182,  1 }, {  18,  57,  2 }, {  18, 182,  2 }, {  19,  57,  3 }, {  19, 181,  3 },
+  {  20,  58,  2 }, {  20, 181,  2 }, {  21,  59,  2 }, {  21, 180,  2 }, {  22,  59,  3 }, {  22, 179,  3 }, {  23,  60,  2 }, {  23, 179,  2 },
+  {  24,  61,  2 }, {  24, 178,  2 }, {  25,  61,  2 }, {  25, 178,  2 }, {  26,  62,  2 }, {  26, 177,  2 }, {  27,  62,  3 }, {  27, 176,  3 },
+  {  28,  63,  2 }, {  28, 176,  2 }, {  29,  64,  2 }, {  29, 175,  2 }, {  30,  64,  2 }, {  30, 175,  2 }, {  31,  65,  2 }, {  31, 174,  2 },
+  {  32,  66,  2 }, {  32, 173,  2 }, {  33,  66,  2 }, {  33, 173,  2 }, {  34,  67,  2 }, {  34, 172,  2 }, {  35,  67,  2 }, {  35, 172,  2 },
+  {  36,  68,  2 }, {  36, 171,  2 }, {  37,  69,  2 }, {  37, 170,  2 }, {  38,  69,  2 }, {  38, 170,  2 }, {  39,  70,  2 }, {  39, 169,  2 },
+  {  17,  59,  2 }, {  17, 180,  2 }, {  18,  59,  3 }, {  18, 179,  3 }, {  19,  60,  2 }, {  19, 179,  2 }, {  20,  60,  3 }, {  20, 178,  3 },
+  {  21,  61,  2 }, {  21, 178,  2 }, {  22,  62,  2 }, {  22, 177,  2 }, {  23,  62,  2 }, {  23, 177,  2 }, {  24,  63,  2 }, {  24, 176,  2 },
+  {  25,  63,  3 }, {  25, 175,  3 }, {  26,  64,  2 }, {  26, 175,  2 }, {  27,  65,  2 }, {  27, 174,  2 }, {  28,  65,  2 }, {  28, 174,  2 },
+  {  29,  66,  2 }, {  29, 173,  2 }, {  30,  66,  3 }, {  30, 172,  3 }, {  31,  67,  2 }, {  31, 172,  2 }, {  32,  68,  2 }, {  32, 171,  2 },
+  {  33,  68,  2 }, {  33, 171,  2 }, {  34,  69,  2 }, {  34, 170,  2 }, {  35,  69,  2 }, {  35, 170,  2 }, {  36,  70,  2 }, {  36, 169,  2 },
+  {  37,  71,  2 }, {  37, 168,  2 }, {  38,  71,  2 }, {  38, 168,  2 }, {  15,  61,  1 }, {  15, 179,  1 }, {  16,  60,  3 }, {  16, 178,  3 },
+  {  17,  61,  2 }, {  17, 178,  2 }, {  18,  62,  2 }, {  18, 177,  2 }, {  19,  62,  3 }, {  19, 176,  3 }, {  20,  63,  2 }, {  20, 176,  2 },
+  {  21,  63,  3 }, {  21, 175,  3 }, {  22,  64,  2 }, {  22, 175,  2 }, {  23,  64,  3 }, {  23, 174,  3 }, {  24,  65,  2 }, {  24, 174,  2 },
+  {  25,  66,  2 }, {  25, 173,  2 }, {  26,  66,  2 }, {  26, 173,  2 }, {  27,  67,  2 }, {  27, 172,  2 }, {  28,  67,  3 }, {  28, 171,  3 },
+  {  29,  68,  2 }, {  29, 171,  2 }, {  30,  69,  2 }, {  30, 170,  2 }, {  31,  69,  2 }, {  31, 170,  2 }, {  32,  70,  2 }, {  32, 169,  2 },
+  {  33,  70,  2 }, {  33, 169,  2 }, {  34,  71,  2 }, {  34, 168,  2 }, {  35,  71,  2 }, {  35, 168,  2 }, {  36,  72,  2 }, {  36, 167,  2 },
+  {  37,  73,  1 }, {  37, 167,  1 }, {  38,  73,  1 }, {  38, 167,  1 }, {  14,  63,  1 }, {  14, 177,  1 }, {  15,  62,  3 }, {  15, 176,  3 },
+  {  16,  63,  2 }, {  16, 176,  2 }, {  17,  63,  3 }, {  17, 175,  3 }, {  18,  64,  2 }, {  18, 175,  2 }, {  19,  65,  2 }, {  19, 174,  2 },
+  {  20,  65,  2 }, {  20, 174,  2 }, {  21,  66,  2 }, {  21, 173,  2 }, {  22,  66,  2 }, {  22, 173,  2 }, {  23,  67,  2 }, {  23, 172,  2 },
+  {  24,  67,  2 }, {  24, 172,  2 }, {  25,  68,  2 }, {  25, 171,  2 }, {  26,  68,  3 }, {  26, 170,  3 }, {  27,  69,  2 }, {  27, 170,  2 },
+  {  28,  70,  2 }, {  28, 169,  2 }, {  29,  70,  2 }, {  29, 169,  2 }, {  30,  71,  2 }, {  30, 168,  2 }, {  31,  71,  2 }, {  31, 168,  2 },
+  {  32,  72,  2 }, {  32, 167,  2 }, {  33,  72,  2 }, {  33, 167,  2 }, {  34,  73,  2 }, {  34, 166,  2 }, {  35,  73,  2 }, {  35, 166,  2 },
+  {  36,  74,  2 }, {  36, 165,  2 }, {  37,  74,  1 }, {  37, 166,  1 }, {  13,  65,  1 }, {  13, 175,  1 }, {  14,  64,  2 }, {  14, 175,  2 },
+  {  15,  65,  2 }, {  15, 174,  2 }, {  16,  65,  3 }, {  16, 173,  3 }, {  17,  66,  2 }, {  17, 173,  2 }, {  18,  66,  3 }, {  18, 172,  3 },
+  {  19,  67,  2 }, {  19, 172,  2 }, {  20,  67,  3 }, {  20, 171,  3 }, {  21,  68,  2 }, {  21, 171,  2 }, {  22,  68,  3 }, {  22, 170,  3 },
+  {  23,  69,  2 }, {  23, 170,  2 }, {  24,  69,  3 }, {  24, 169,  3 }, {  25,  70,  2 }, {  25, 169,  2 }, {  26,  71,  2 }, {  26, 168,  2 },
+  {  27,  71,  2 }, {  27, 168,  2 }, {  28,  72,  2 }, {  28, 167,  2 }, {  29,  72,  2 }, {  29, 167,  2 }, {  30,  73,  2 }, {  30, 166,  2 },
+  {  31,  73,  2 }, {  31, 166,  2 }, {  32,  74,  2 }, {  32, 165,  2 }, {  33,  74,  2 }, {  33, 165,  2 }, {  34,  75,  2 }, {  34, 164,  2 },
+  {  35,  75,  2 }, {  35, 164,  2 }, {  36,  76,  1 }, {  36, 164,  1 }, {  12,  67,  1 }, {  12, 173,  1 }, {  13,  66,  2 }, {  13, 173,  2 },
+  {  14,  66,  3 }, {  14, 172,  3 }, {  15,  67,  2 }, {  15, 172,  2 }, {  16,  68,  2 }, {  16, 171,  2 }, {  17,  68,  2 }, {  17, 171,  2 },
+  {  18,  69,  2 }, {  18, 170,  2 }, {  19,  69,  2 }, {  19, 170,  2 }, {  20,  70,  2 }, {  20, 169,  2 }, {  21,  70,  2 }, {  21, 169,  2 },
+  {  22,  71,  2 }, {  22, 168,  2 }, {  23,  71,  2 }, {  23, 168,  2 }, {  24,  72,  2 }, {  24, 167,  2 }, {  25,  72,  2 }, {  25, 167,  2 },
+  {  26,  73,  2 }, {  26, 166,  2 }, {  27,  73,  2 }, {  27, 166,  2 }, {  28,  74,  2 }, {  28, 165,  2 }, {  29,  74,  2 }, {  29, 165,  2 },
+  {  30,  75,  2 }, {  30, 164,  2 }, {  31,  75,  2 }, {  31, 164,  2 }, {  32,  76,  2 }, {  32, 163,  2 }, {  33,  76,  2 }, {  33, 163,  2 },
+  {  34,  77,  2 }, {  34, 162,  2 }, {  35,  77,  2 }, {  35, 162,  2 }, {  11,  69,  1 }, {  11, 171,  1 }, {  12,  68,  2 }, {  12, 171,  2 },
+  {  13,  68,  3 }, {  13, 170,  3 }, {  14,  69,  2 }, {  14, 170,  2 }, {  15,  69,  3 }, {  15, 169,  3 }, {  16,  70,  2 }, {  16, 169,  2 },
+  {  17,  70,  2 }, {  17, 169,  2 }, {  18,  71,  2 }, {  18, 168,  2 }, {  19,  71,  2 }, {  19, 168,  2 }, {  20,  72,  2 }, {  20, 167,  2 },
+  {  21,  72,  2 }, {  21, 167,  2 }, {  22,  73,  2 }, {  22, 166,  2 }, {  23,  73,  2 }, {  23, 166,  2 }, {  24,  74,  2 }, {  24, 165,  2 },
+  {  25,  74,  2 }, {  25, 165,  2 }, {  26,  75,  2 }, {  26, 164,  2 }, {  27,  75,  2 }, {  27, 164,  2 }, {  28,  76,  2 }, {  28, 163,  2 },
+  {  29,  76,  2 }, {  29, 163,  2 }, {  30,  77,  2 }, {  30, 162,  2 }, {  31,  77,  2 }, {  31, 162,  2 }, {  32,  78,  1 }, {  32, 162,  1 },
+  {  33,  78,  2 }, {  33, 161,  2 }, {  34,  79,  1 }, {  34, 161,  1 }, {  10,  71,  1 }, {  10, 169,  1 }, {  11,  70,  2 }, {  11, 169,  2 },
+  {  12,  70,  2 }, {  12, 169,  2 }, {  13,  71,  2 }, {  13, 168,  2 }, {  14,  71,  2 }, {  14, 168,  2 }, {  15,  72,  2 }, {  15, 167,  2 },
+  {  16,  72,  2 }, {  16, 167,  2 }, {  17,  72,  3 }, {  17, 166,  3 }, {  18,  73,  2 }, {  18, 166,  2 }, {  19,  73,  3 }, {  19, 165,  3 },
+  {  20,  74,  2 }, {  20, 165,  2 }, {  21,  74,  2 }, {  21, 165,  2 }, {  22,  75,  2 }, {  22, 164,  2 }, {  23,  75,  2 }, {  23, 164,  2 },
+  {  24,  76,  2 }, {  24, 163,  2 }, {  25,  76,  2 }, {  25, 163,  2 }, {  26,  77,  2 }, {  26, 162,  2 }, {  27,  77,  2 }, {  27, 162,  2 },
+  {  28,  78,  2 }, {  28, 161,  2 }, {  29,  78,  2 }, {  29, 161,  2 }, {  30,  79,  1 }, {  30, 161,  1 }, {  31,  79,  2 }, {  31, 160,  2 },
+  {  32,  79,  2 }, {  32, 160,  2 }, {  33,  80,  2 }, {  33, 159,  2 }, {  34,  80,  1 }, {  34, 160,  1 }, {  10,  72,  2 }, {  10, 167,  2 },
+  {  11,  72,  2 }, {  11, 167,  2 }, {  12,  72,  3 }, {  12, 166,  3 }, {  13,  73,  2 }, {  13, 166,  2 }, {  14,  73,  3 }, {  14, 165,  3 },
+  {  15,  74,  2 }, {  15, 165,  2 }, {  16,  74,  2 }, {  16, 165,  2 }, {  17,  75,  2 }, {  17, 164,  2 }, {  18,  75,  2 }, {  18, 164,  2 },
+  {  19,  76,  2 }, {  19, 163,  2 }, {  20,  76,  2 }, {  20, 163,  2 }, {  21,  76,  2 }, {  21, 163,  2 }, {  22,  77,  2 }, {  22, 162,  2 },
+  {  23,  77,  2 }, {  23, 162,  2 }, {  24,  78,  2 }, {  24, 161,  2 }, {  25,  78,  2 }, {  25, 161,  2 }, {  26,  79,  2 }, {  26, 160,  2 },
+  {  27,  79,  2 }, {  27, 160,  2 }, {  28,  80,  1 }, {  28, 160,  1 }, {  29,  80,  2 }, {  29, 159,  2 }, {  30,  80,  2 }, {  30, 159,  2 },
+  {  31,  81,  2 }, {  31, 158,  2 }, {  32,  81,  2 }, {  32, 158,  2 }, {  33,  82,  2 }, {  33, 157,  2 }, {   9,  74,  2 }, {   9, 165,  2 },
+  {  10,  74,  2 }, {  10, 165,  2 }, {  11,  74,  2 }, {  11, 165,  2 }, {  12,  75,  2 }, {  12, 164,  2 }, {  13,  75,  2 }, {  13, 164,  2 },
+  {  14,  76,  2 }, {  14, 163,  2 }, {  15,  76,  2 }, {  15, 163,  2 }, {  16,  76,  2 }, {  16, 163,  2 }, {  17,  77,  2 }, {  17, 162,  2 },
+  {  18,  77,  2 }, {  18, 162,  2 }, {  19,  78,  2 }, {  19, 161,  2 }, {  20,  78,  2 }, {  20, 161,  2 }, {  21,  78,  3 }, {  21, 160,  3 },
+  {  22,  79,  2 }, {  22, 160,  2 }, {  23,  79,  2 }, {  23, 160,  2 }, {  24,  80,  2 }, {  24, 159,  2 }, {  25,  80,  2 }, {  25, 159,  2 },
+  {  26,  81,  2 }, {  26, 158,  2 }, {  27,  81,  2 }, {  27, 158,  2 }, {  28,  81,  2 }, {  28, 158,  2 }, {  29,  82,  2 }, {  29, 157,  2 },
+  {  30,  82,  2 }, {  30, 157,  2 }, {  31,  83,  2 }, {  31, 156,  2 }, {  32,  83,  2 }, {  32, 156,  2 }, {   8,  76,  2 }, {   8, 163,  2 },
+  {   9,  76,  2 }, {   9, 163,  2 }, {  10,  76,  2 }, {  10, 163,  2 }, {  11,  76,  3 }, {  11, 162,  3 }, {  12,  77,  2 }, {  12, 162,  2 },
+  {  13,  77,  2 }, {  13, 162,  2 }, {  14,  78,  2 }, {  14, 161,  2 }, {  15,  78,  2 }, {  15, 161,  2 }, {  16,  78,  3 }, {  16, 160,  3 },
+  {  17,  79,  2 }, {  17, 160,  2 }, {  18,  79,  2 }, {  18, 160,  2 }, {  19,  80,  2 }, {  19, 159,  2 }, {  20,  80,  2 }, {  20, 159,  2 },
+  {  21,  81,  1 }, {  21, 159,  1 }, {  22,  81,  2 }, {  22, 158,  2 }, {  23,  81,  2 }, {  23, 158,  2 }, {  24,  82,  2 }, {  24, 157,  2 },
+  {  25,  82,  2 }, {  25, 157,  2 }, {  26,  83,  1 }, {  26, 157,  1 }, {  27,  83,  2 }, {  27, 156,  2 }, {  28,  83,  2 }, {  28, 156,  2 },
+  {  29,  84,  2 }, {  29, 155,  2 }, {  30,  84,  2 }, {  30, 155,  2 }, {  31,  85,  1 }, {  31, 155,  1 }, {  32,  85,  1 }, {  32, 155,  1 },
+  {   8,  78,  2 }, {   8, 161,  2 }, {   9,  78,  2 }, {   9, 161,  2 }, {  10,  78,  2 }, {  10, 161,  2 }, {  11,  79,  2 }, {  11, 160,  2 },
+  {  12,  79,  2 }, {  12, 160,  2 }, {  13,  79,  3 }, {  13, 159,  3 }, {  14,  80,  2 }, {  14, 159,  2 }, {  15,  80,  2 }, {  15, 159,  2 },
+  {  16,  81,  2 }, {  16, 158,  2 }, {  17,  81,  2 }, {  17, 158,  2 }, {  18,  81,  2 }, {  18, 158,  2 }, {  19,  82,  2 }, {  19, 157,  2 },
+  {  20,  82,  2 }, {  20, 157,  2 }, {  21,  82,  2 }, {  21, 157,  2 }, {  22,  83,  2 }, {  22, 156,  2 }, {  23,  83,  2 }, {  23, 156,  2 },
+  {  24,  84,  2 }, {  24, 155,  2 }, {  25,  84,  2 }, {  25, 155,  2 }, {  26,  84,  2 }, {  26, 155,  2 }, {  27,  85,  2 }, {  27, 154,  2 },
+  {  28,  85,  2 }, {  28, 154,  2 }, {  29,  86,  1 }, {  29, 154,  1 }, {  30,  86,  2 }, {  30, 153,  2 }, {  31,  86,  2 }, {  31, 153,  2 },
+  {   7,  79,  3 }, {   7, 159,  3 }, {   8,  80,  2 }, {   8, 159,  2 }, {   9,  80,  2 }, {   9, 159,  2 }, {  10,  80,  3 }, {  10, 158,  3 },
+  {  11,  81,  2 }, {  11, 158,  2 }, {  12,  81,  2 }, {  12, 158,  2 }, {  13,  82,  2 }, {  13, 157,  2 }, {  14,  82,  2 }, {  14, 157,  2 },
+  {  15,  82,  2 }, {  15, 157,  2 }, {  16,  83,  2 }, {  16, 156,  2 }, {  17,  83,  2 }, {  17, 156,  2 }, {  18,  83,  2 }, {  18, 156,  2 },
+  {  19,  84,  2 }, {  19, 155,  2 }, {  20,  84,  2 }, {  20, 155,  2 }, {  21,  84,  2 }, {  21, 155,  2 }, {  22,  85,  2 }, {  22, 154,  2 },
+  {  23,  85,  2 }, {  23, 154,  2 }, {  24,  86,  1 }, {  24, 154,  1 }, {  25,  86,  2 }, {  25, 153,  2 }, {  26,  86,  2 }, {  26, 153,  2 },
+  {  27,  87,  1 }, {  27, 153,  1 }, {  28,  87,  2 }, {  28, 152,  2 }, {  29,  87,  2 }, {  29, 152,  2 }, {  30,  88,  2 }, {  30, 151,  2 },
+  {  31,  88,  1 }, {  31, 152,  1 }, {   6,  81,  2 }, {   6, 158,  2 }, {   7,  82,  2 }, {   7, 157,  2 }, {   8,  82,  2 }, {   8, 157,  2 },
+  {   9,  82,  2 }, {   9, 157,  2 }, {  10,  83,  2 }, {  10, 156,  2 }, {  11,  83,  2 }, {  11, 156,  2 }, {  12,  83,  2 }, {  12, 156,  2 },
+  {  13,  84,  2 }, {  13, 155,  2 }, {  14,  84,  2 }, {  14, 155,  2 }, {  15,  84,  2 }, {  15, 155,  2 }, {  16,  85,  2 }, {  16, 154,  2 },
+  {  17,  85,  2 }, {  17, 154,  2 }, {  18,  85,  2 }, {  18, 154,  2 }, {  19,  86,  2 }, {  19, 153,  2 }, {  20,  86,  2 }, {  20, 153,  2 },
+  {  21,  86,  2 }, {  21, 153,  2 }, {  22,  87,  2 }, {  22, 152,  2 }, {  23,  87,  2 }, {  23, 152,  2 }, {  24,  87,  2 }, {  24, 152,  2 },
+  {  25,  88,  2 }, {  25, 151,  2 }, {  26,  88,  2 }, {  26, 151,  2 }, {  27,  88,  2 }, {  27, 151,  2 }, {  28,  89,  2 }, {  28, 150,  2 },
+  {  29,  89,  2 }, {  29, 150,  2 }, {  30,  90,  1 }, {  30, 150,  1 }, {   6,  83,  3 }, {   6, 155,  3 }, {   7,  84,  2 }, {   7, 155,  2 },
+  {   8,  84,  2 }, {   8, 155,  2 }, {   9,  84,  3 }, {   9, 154,  3 }, {  10,  85,  2 }, {  10, 154,  2 }, {  11,  85,  2 }, {  11, 154,  2 },
+  {  12,  85,  2 }, {  12, 154,  2 }, {  13,  86,  2 }, {  13, 153,  2 }, {  14,  86,  2 }, {  14, 153,  2 }, {  15,  86,  2 }, {  15, 153,  2 },
+  {  16,  87,  2 }, {  16, 152,  2 }, {  17,  87,  2 }, {  17, 152,  2 }, {  18,  87,  2 }, {  18, 152,  2 }, {  19,  88,  2 }, {  19, 151,  2 },
+  {  20,  88,  2 }, {  20, 151,  2 }, {  21,  88,  2 }, {  21, 151,  2 }, {  22,  89,  2 }, {  22, 150,  2 }, {  23,  89,  2 }, {  23, 150,  2 },
+  {  24,  89,  2 }, {  24, 150,  2 }, {  25,  90,  1 }, {  25, 150,  1 }, {  26,  90,  2 }, {  26, 149,  2 }, {  27,  90,  2 }, {  27, 149,  2 },
+  {  28,  91,  1 }, {  28, 149,  1 }, {  29,  91,  2 }, {  29, 148,  2 }, {  30,  91,  1 }, {  30, 149,  1 }, {   5,  85,  3 }, {   5, 153,  3 },
+  {   6,  86,  2 }, {   6, 153,  2 }, {   7,  86,  2 }, {   7, 153,  2 }, {   8,  86,  2 }, {   8, 153,  2 }, {   9,  87,  2 }, {   9, 152,  2 },
+  {  10,  87,  2 }, {  10, 152,  2 }, {  11,  87,  2 }, {  11, 152,  2 }, {  12,  87,  3 }, {  12, 151,  3 }, {  13,  88,  2 }, {  13, 151,  2 },
+  {  14,  88,  2 }, {  14, 151,  2 }, {  15,  88,  2 }, {  15, 151,  2 }, {  16,  89,  2 }, {  16, 150,  2 }, {  17,  89,  2 }, {  17, 150,  2 },
+  {  18,  89,  2 }, {  18, 150,  2 }, {  19,  90,  2 }, {  19, 149,  2 }, {  20,  90,  2 }, {  20, 149,  2 }, {  21,  90,  2 }, {  21, 149,  2 },
+  {  22,  91,  1 }, {  22, 149,  1 }, {  23,  91,  2 }, {  23, 148,  2 }, {  24,  91,  2 }, {  24, 148,  2 }, {  25,  91,  2 }, {  25, 148,  2 },
+  {  26,  92,  2 }, {  26, 147,  2 }, {  27,  92,  2 }, {  27, 147,  2 }, {  28,  92,  2 }, {  28, 147,  2 }, {  29,  93,  1 }, {  29, 147,  1 },
+  {   4,  88,  1 }, {   4, 152,  1 }, {   5,  88,  2 }, {   5, 151,  2 }, {   6,  88,  2 }, {   6, 151,  2 }, {   7,  88,  2 }, {   7, 151,  2 },
+  {   8,  88,  2 }, {   8, 151,  2 }, {   9,  89,  2 }, {   9, 150,  2 }, {  10,  89,  2 }, {  10, 150,  2 }, {  11,  89,  2 }, {  11, 150,  2 },
+  {  12,  90,  2 }, {  12, 149,  2 }, {  13,  90,  2 }, {  13, 149,  2 }, {  14,  90,  2 }, {  14, 149,  2 }, {  15,  90,  2 }, {  15, 149,  2 },
+  {  16,  91,  2 }, {  16, 148,  2 }, {  17,  91,  2 }, {  17, 148,  2 }, {  18,  91,  2 }, {  18, 148,  2 }, {  19,  92,  1 }, {  19, 148,  1 },
+  {  20,  92,  2 }, {  20, 147,  2 }, {  21,  92,  2 }, {  21, 147,  2 }, {  22,  92,  2 }, {  22, 147,  2 }, {  23,  93,  2 }, {  23, 146,  2 },
+  {  24,  93,  2 }, {  24, 146,  2 }, {  25,  93,  2 }, {  25, 146,  2 }, {  26,  94,  1 }, {  26, 146,  1 }, {  27,  94,  2 }, {  27, 145,  2 },
+  {  28,  94,  2 }, {  28, 145,  2 }, {  29,  94,  1 }, {  29, 146,  1 }, {   4,  89,  3 }, {   4, 149,  3 }, {   5,  90,  2 }, {   5, 149,  2 },
+  {   6,  90,  2 }, {   6, 149,  2 }, {   7,  90,  2 }, {   7, 149,  2 }, {   8,  90,  3 }, {   8, 148,  3 }, {   9,  91,  2 }, {   9, 148,  2 },
+  {  10,  91,  2 }, {  10, 148,  2 }, {  11,  91,  2 }, {  11, 148,  2 }, {  12,  92,  2 }, {  12, 147,  2 }, {  13,  92,  2 }, {  13, 147,  2 },
+  {  14,  92,  2 }, {  14, 147,  2 }, {  15,  92,  2 }, {  15, 147,  2 }, {  16,  93,  2 }, {  16, 146,  2 }, {  17,  93,  2 }, {  17, 146,  2 },
+  {  18,  93,  2 }, {  18, 146,  2 }, {  19,  93,  2 }, {  19, 146,  2 }, {  20,  94,  2 }, {  20, 145,  2 }, {  21,  94,  2 }, {  21, 145,  2 },
+  {  22,  94,  2 }, {  22, 145,  2 }, {  23,  95,  1 }, {  23, 145,  1 }, {  24,  95,  2 }, {  24, 144,  2 }, {  25,  95,  2 }, {  25, 144,  2 },
+  {  26,  95,  2 }, {  26, 144,  2 }, {  27,  96,  1 }, {  27, 144,  1 }, {  28,  96,  2 }, {  28, 143,  2 }, {   3,  92,  1 }, {   3, 148,  1 },
+  {   4,  92,  2 }, {   4, 147,  2 }, {   5,  92,  2 }, {   5, 147,  2 }, {   6,  92,  2 }, {   6, 147,  2 }, {   7,  92,  2 }, {   7, 147,  2 },
+  {   8,  93,  2 }, {   8, 146,  2 }, {   9,  93,  2 }, {   9, 146,  2 }, {  10,  93,  2 }, {  10, 146,  2 }, {  11,  93,  2 }, {  11, 146,  2 },
+  {  12,  94,  2 }, {  12, 145,  2 }, {  13,  94,  2 }, {  13, 145,  2 }, {  14,  94,  2 }, {  14, 145,  2 }, {  15,  94,  2 }, {  15, 145,  2 },
+  {  16,  95,  1 }, {  16, 145,  1 }, {  17,  95,  2 }, {  17, 144,  2 }, {  18,  95,  2 }, {  18, 144,  2 }, {  19,  95,  2 }, {  19, 144,  2 },
+  {  20,  96,  1 }, {  20, 144,  1 }, {  21,  96,  2 }, {  21, 143,  2 }, {  22,  96,  2 }, {  22, 143,  2 }, {  23,  96,  2 }, {  23, 143,  2 },
+  {  24,  97,  1 }, {  24, 143,  1 }, {  25,  97,  2 }, {  25, 142,  2 }, {  26,  97,  2 }, {  26, 142,  2 }, {  27,  97,  2 }, {  27, 142,  2 },
+  {  28,  98,  1 }, {  28, 142,  1 }, {   3,  93,  3 }, {   3, 145,  3 }, {   4,  94,  2 }, {   4, 145,  2 }, {   5,  94,  2 }, {   5, 145,  2 },
+  {   6,  94,  2 }, {   6, 145,  2 }, {   7,  94,  2 }, {   7, 145,  2 }, {   8,  95,  2 }, {   8, 144,  2 }, {   9,  95,  2 }, {   9, 144,  2 },
+  {  10,  95,  2 }, {  10, 144,  2 }, {  11,  95,  2 }, {  11, 144,  2 }, {  12,  96,  2 }, {  12, 143,  2 }, {  13,  96,  2 }, {  13, 143,  2 },
+  {  14,  96,  2 }, {  14, 143,  2 }, {  15,  96,  2 }, {  15, 143,  2 }, {  16,  96,  2 }, {  16, 143,  2 }, {  17,  97,  2 }, {  17, 142,  2 },
+  {  18,  97,  2 }, {  18, 142,  2 }, {  19,  97,  2 }, {  19, 142,  2 }, {  20,  97,  2 }, {  20, 142,  2 }, {  21,  98,  1 }, {  21, 142,  1 },
+  {  22,  98,  2 }, {  22, 141,  2 }, {  23,  98,  2 }, {  23, 141,  2 }, {  24,  98,  2 }, {  24, 141,  2 }, {  25,  99,  1 }, {  25, 141,  1 },
+  {  26,  99,  2 }, {  26, 140,  2 }, {  27,  99,  2 }, {  27, 140,  2 }, {   2,  96,  2 }, {   2, 143,  2 }, {   3,  96,  2 }, {   3, 143,  2 },
+  {   4,  96,  2 }, {   4, 143,  2 }, {   5,  96,  2 }, {   5, 143,  2 }, {   6,  96,  2 }, {   6, 143,  2 }, {   7,  96,  3 }, {   7, 142,  3 },
+  {   8,  97,  2 }, {   8, 142,  2 }, {   9,  97,  2 }, {   9, 142,  2 }, {  10,  97,  2 }, {  10, 142,  2 }, {  11,  97,  2 }, {  11, 142,  2 },
+  {  12,  98,  2 }, {  12, 141,  2 }, {  13,  98,  2 }, {  13, 141,  2 }, {  14,  98,  2 }, {  14, 141,  2 }, {  15,  98,  2 }, {  15, 141,  2 },
+  {  16,  98,  2 }, {  16, 141,  2 }, {  17,  99,  1 }, {  17, 141,  1 }, {  18,  99,  2 }, {  18, 140,  2 }, {  19,  99,  2 }, {  19, 140,  2 },
+  {  20,  99,  2 }, {  20, 140,  2 }, {  21,  99,  2 }, {  21, 140,  2 }, {  22, 100,  1 }, {  22, 140,  1 }, {  23, 100,  2 }, {  23, 139,  2 },
+  {  24, 100,  2 }, {  24, 139,  2 }, {  25, 100,  2 }, {  25, 139,  2 }, {  26, 101,  1 }, {  26, 139,  1 }, {  27, 101,  1 }, {  27, 139,  1 },
+  {   2,  98,  2 }, {   2, 141,  2 }, {   3,  98,  2 }, {   3, 141,  2 }, {   4,  98,  2 }, {   4, 141,  2 }, {   5,  98,  2 }, {   5, 141,  2 },
+  {   6,  98,  2 }, {   6, 141,  2 }, {   7,  99,  2 }, {   7, 140,  2 }, {   8,  99,  2 }, {   8, 140,  2 }, {   9,  99,  2 }, {   9, 140,  2 },
+  {  10,  99,  2 }, {  10, 140,  2 }, {  11,  99,  2 }, {  11, 140,  2 }, {  12, 100,  1 }, {  12, 140,  1 }, {  13, 100,  2 }, {  13, 139,  2 },
+  {  14, 100,  2 }, {  14, 139,  2 }, {  15, 100,  2 }, {  15, 139,  2 }, {  16, 100,  2 }, {  16, 139,  2 }, {  17, 100,  2 }, {  17, 139,  2 },
+  {  18, 101,  2 }, {  18, 138,  2 }, {  19, 101,  2 }, {  19, 138,  2 }, {  20, 101,  2 }, {  20, 138,  2 }, {  21, 101,  2 }, {  21, 138,  2 },
+  {  22, 101,  2 }, {  22, 138,  2 }, {  23, 102,  1 }, {  23, 138,  1 }, {  24, 102,  2 }, {  24, 137,  2 }, {  25, 102,  2 }, {  25, 137,  2 },
+  {  26, 102,  2 }, {  26, 137,  2 }, {  27, 102,  2 }, {  27, 137,  2 }, {   2, 100,  2 }, {   2, 139,  2 }, {   3, 100,  2 }, {   3, 139,  2 },
+  {   4, 100,  2 }, {   4, 139,  2 }, {   5, 100,  2 }, {   5, 139,  2 }, {   6, 100,  2 }, {   6, 139,  2 }, {   7, 101,  2 }, {   7, 138,  2 },
+  {   8, 101,  2 }, {   8, 138,  2 }, {   9, 101,  2 }, {   9, 138,  2 }, {  10, 101,  2 }, {  10, 138,  2 }, {  11, 101,  2 }, {  11, 138,  2 },
+  {  12, 101,  2 }, {  12, 138,  2 }, {  13, 102,  2 }, {  13, 137,  2 }, {  14, 102,  2 }, {  14, 137,  2 }, {  15, 102,  2 }, {  15, 137,  2 },
+  {  16, 102,  2 }, {  16, 137,  2 }, {  17, 102,  2 }, {  17, 137,  2 }, {  18, 103,  1 }, {  18, 137,  1 }, {  19, 103,  2 }, {  19, 136,  2 },
+  {  20, 103,  2 }, {  20, 136,  2 }, {  21, 103,  2 }, {  21, 136,  2 }, {  22, 103,  2 }, {  22, 136,  2 }, {  23, 103,  2 }, {  23, 136,  2 },
+  {  24, 104,  1 }, {  24, 136,  1 }, {  25, 104,  1 }, {  25, 136,  1 }, {  26, 104,  2 }, {  26, 135,  2 }, {   1, 102,  2 }, {   1, 137,  2 },
+  {   2, 102,  2 }, {   2, 137,  2 }, {   3, 102,  2 }, {   3, 137,  2 }, {   4, 102,  2 }, {   4, 137,  2 }, {   5, 102,  2 }, {   5, 137,  2 },
+  {   6, 102,  2 }, {   6, 137,  2 }, {   7, 103,  2 }, {   7, 136,  2 }, {   8, 103,  2 }, {   8, 136,  2 }, {   9, 103,  2 }, {   9, 136,  2 },
+  {  10, 103,  2 }, {  10, 136,  2 }, {  11, 103,  2 }, {  11, 136,  2 }, {  12, 103,  2 }, {  12, 136,  2 }, {  13, 104,  1 }, {  13, 136,  1 },
+  {  14, 104,  2 }, {  14, 135,  2 }, {  15, 104,  2 }, {  15, 135,  2 }, {  16, 104,  2 }, {  16, 135,  2 }, {  17, 104,  2 }, {  17, 135,  2 },
+  {  18, 104,  2 }, {  18, 135,  2 }, {  19, 105,  1 }, {  19, 135,  1 }, {  20, 105,  1 }, {  20, 135,  1 }, {  21, 105,  2 }, {  21, 134,  2 },
+  {  22, 105,  2 }, {  22, 134,  2 }, {  23, 105,  2 }, {  23, 134,  2 }, {  24, 105,  2 }, {  24, 134,  2 }, {  25, 105,  2 }, {  25, 134,  2 },
+  {  26, 106,  1 }, {  26, 134,  1 }, {   1, 104,  2 }, {   1, 135,  2 }, {   2, 104,  2 }, {   2, 135,  2 }, {   3, 104,  2 }, {   3, 135,  2 },
+  {   4, 104,  2 }, {   4, 135,  2 }, {   5, 104,  2 }, {   5, 135,  2 }, {   6, 104,  3 }, {   6, 134,  3 }, {   7, 105,  2 }, {   7, 134,  2 },
+  {   8, 105,  2 }, {   8, 134,  2 }, {   9, 105,  2 }, {   9, 134,  2 }, {  10, 105,  2 }, {  10, 134,  2 }, {  11, 105,  2 }, {  11, 134,  2 },
+  {  12, 105,  2 }, {  12, 134,  2 }, {  13, 105,  2 }, {  13, 134,  2 }, {  14, 106,  1 }, {  14, 134,  1 }, {  15, 106,  2 }, {  15, 133,  2 },
+  {  16, 106,  2 }, {  16, 133,  2 }, {  17, 106,  2 }, {  17, 133,  2 }, {  18, 106,  2 }, {  18, 133,  2 }, {  19, 106,  2 }, {  19, 133,  2 },
+  {  20, 106,  2 }, {  20, 133,  2 }, {  21, 107,  1 }, {  21, 133,  1 }, {  22, 107,  1 }, {  22, 133,  1 }, {  23, 107,  2 }, {  23, 132,  2 },
+  {  24, 107,  2 }, {  24, 132,  2 }, {  25, 107,  2 }, {  25, 132,  2 }, {  26, 107,  2 }, {  26, 132,  2 }, {   1, 106,  2 }, {   1, 133,  2 },
+  {   2, 106,  2 }, {   2, 133,  2 }, {   3, 106,  2 }, {   3, 133,  2 }, {   4, 106,  2 }, {   4, 133,  2 }, {   5, 106,  2 }, {   5, 133,  2 },
+  {   6, 107,  2 }, {   6, 132,  2 }, {   7, 107,  2 }, {   7, 132,  2 }, {   8, 107,  2 }, {   8, 132,  2 }, {   9, 107,  2 }, {   9, 132,  2 },
+  {  10, 107,  2 }, {  10, 132,  2 }, {  11, 107,  2 }, {  11, 132,  2 }, {  12, 107,  2 }, {  12, 132,  2 }, {  13, 107,  2 }, {  13, 132,  2 },
+  {  14, 107,  2 }, {  14, 132,  2 }, {  15, 108,  1 }, {  15, 132,  1 }, {  16, 108,  2 }, {  16, 131,  2 }, {  17, 108,  2 }, {  17, 131,  2 },
+  {  18, 108,  2 }, {  18, 131,  2 }, {  19, 108,  2 }, {  19, 131,  2 }, {  20, 108,  2 }, {  20, 131,  2 }, {  21, 108,  2 }, {  21, 131,  2 },
+  {  22, 108,  2 }, {  22, 131,  2 }, {  23, 109,  1 }, {  23, 131,  1 }, {  24, 109,  1 }, {  24, 131,  1 }, {  25, 109,  2 }, {  25, 130,  2 },
+  {  26, 109,  2 }, {  26, 130,  2 }, {   1, 108,  2 }, {   1, 131,  2 }, {   2, 108,  2 }, {   2, 131,  2 }, {   3, 108,  2 }, {   3, 131,  2 },
+  {   4, 108,  2 }, {   4, 131,  2 }, {   5, 108,  2 }, {   5, 131,  2 }, {   6, 109,  2 }, {   6, 130,  2 }, {   7, 109,  2 }, {   7, 130,  2 },
+  {   8, 109,  2 }, {   8, 130,  2 }, {   9, 109,  2 }, {   9, 130,  2 }, {  10, 109,  2 }, {  10, 130,  2 }, {  11, 109,  2 }, {  11, 130,  2 },
+  {  12, 109,  2 }, {  12, 130,  2 }, {  13, 109,  2 }, {  13, 130,  2 }, {  14, 109,  2 }, {  14, 130,  2 }, {  15, 109,  2 }, {  15, 130,  2 },
+  {  16, 110,  1 }, {  16, 130,  1 }, {  17, 110,  1 }, {  17, 130,  1 }, {  18, 110,  2 }, {  18, 129,  2 }, {  19, 110,  2 }, {  19, 129,  2 },
+  {  20, 110,  2 }, {  20, 129,  2 }, {  21, 110,  2 }, {  21, 129,  2 }, {  22, 110,  2 }, {  22, 129,  2 }, {  23, 110,  2 }, {  23, 129,  2 },
+  {  24, 110,  2 }, {  24, 129,  2 }, {  25, 111,  1 }, {  25, 129,  1 }, {   0, 110,  2 }, {   0, 129,  2 }, {   1, 110,  2 }, {   1, 129,  2 },
+  {   2, 110,  2 }, {   2, 129,  2 }, {   3, 110,  2 }, {   3, 129,  2 }, {   4, 110,  2 }, {   4, 129,  2 }, {   5, 110,  2 }, {   5, 129,  2 },
+  {   6, 111,  2 }, {   6, 128,  2 }, {   7, 111,  2 }, {   7, 128,  2 }, {   8, 111,  2 }, {   8, 128,  2 }, {   9, 111,  2 }, {   9, 128,  2 },
+  {  10, 111,  2 }, {  10, 128,  2 }, {  11, 111,  2 }, {  11, 128,  2 }, {  12, 111,  2 }, {  12, 128,  2 }, {  13, 111,  2 }, {  13, 128,  2 },
+  {  14, 111,  2 }, {  14, 128,  2 }, {  15, 111,  2 }, {  15, 128,  2 }, {  16, 111,  2 }, {  16, 128,  2 }, {  17, 111,  2 }, {  17, 128,  2 },
+  {  18, 112,  1 }, {  18, 128,  1 }, {  19, 112,  1 }, {  19, 128,  1 }, {  20, 112,  2 }, {  20, 127,  2 }, {  21, 112,  2 }, {  21, 127,  2 },
+  {  22, 112,  2 }, {  22, 127,  2 }, {  23, 112,  2 }, {  23, 127,  2 }, {  24, 112,  2 }, {  24, 127,  2 }, {  25, 112,  2 }, {  25, 127,  2 },
+  {   0, 112,  2 }, {   0, 127,  2 }, {   1, 112,  2 }, {   1, 127,  2 }, {   2, 112,  2 }, {   2, 127,  2 }, {   3, 112,  2 }, {   3, 127,  2 },
+  {   4, 112,  2 }, {   4, 127,  2 }, {   5, 112,  2 }, {   5, 127,  2 }, {   6, 113,  2 }, {   6, 126,  2 }, {   7, 113,  2 }, {   7, 126,  2 },
+  {   8, 113,  2 }, {   8, 126,  2 }, {   9, 113,  2 }, {   9, 126,  2 }, {  10, 113,  2 }, {  10, 126,  2 }, {  11, 113,  2 }, {  11, 126,  2 },
+  {  12, 113,  2 }, {  12, 126,  2 }, {  13, 113,  2 }, {  13, 126,  2 }, {  14, 113,  2 }, {  14, 126,  2 }, {  15, 113,  2 }, {  15, 126,  2 },
+  {  16, 113,  2 }, {  16, 126,  2 }, {  17, 113,  2 }, {  17, 126,  2 }, {  18, 113,  2 }, {  18, 126,  2 }, {  19, 113,  2 }, {  19, 126,  2 },
+  {  20, 114,  1 }, {  20, 126,  1 }, {  21, 114,  1 }, {  21, 126,  1 }, {  22, 114,  1 }, {  22, 126,  1 }, {  23, 114,  1 }, {  23, 126,  1 },
+  {  24, 114,  1 }, {  24, 126,  1 }, {  25, 114,  2 }, {  25, 125,  2 }, {   0, 114,  2 }, {   0, 125,  2 }, {   1, 114,  2 }, {   1, 125,  2 },
+  {   2, 114,  2 }, {   2, 125,  2 }, {   3, 114,  2 }, {   3, 125,  2 }, {   4, 114,  2 }, {   4, 125,  2 }, {   5, 114,  2 }, {   5, 125,  2 },
+  {   6, 115,  2 }, {   6, 124,  2 }, {   7, 115,  2 }, {   7, 124,  2 }, {   8, 115,  2 }, {   8, 124,  2 }, {   9, 115,  2 }, {   9, 124,  2 },
+  {  10, 115,  2 }, {  10, 124,  2 }, {  11, 115,  2 }, {  11, 124,  2 }, {  12, 115,  2 }, {  12, 124,  2 }, {  13, 115,  2 }, {  13, 124,  2 },
+  {  14, 115,  2 }, {  14, 124,  2 }, {  15, 115,  2 }, {  15, 124,  2 }, {  16, 115,  2 }, {  16, 124,  2 }, {  17, 115,  2 }, {  17, 124,  2 },
+  {  18, 115,  2 }, {  18, 124,  2 }, {  19, 115,  2 }, {  19, 124,  2 }, {  20, 115,  2 }, {  20, 124,  2 }, {  21, 115,  2 }, {  21, 124,  2 },
+  {  22, 115,  2 }, {  22, 124,  2 }, {  23, 115,  2 }, {  23, 124,  2 }, {  24, 115,  2 }, {  24, 124,  2 }, {  25, 116,  1 }, {  25, 124,  1 },
+  {   0, 116,  2 }, {   0, 123,  2 }, {   1, 116,  2 }, {   1, 123,  2 }, {   2, 116,  2 }, {   2, 123,  2 }, {   3, 116,  2 }, {   3, 123,  2 },
+  {   4, 116,  2 }, {   4, 123,  2 }, {   5, 116,  2 }, {   5, 123,  2 }, {   6, 117,  2 }, {   6, 122,  2 }, {   7, 117,  2 }, {   7, 122,  2 },
+  {   8, 117,  2 }, {   8, 122,  2 }, {   9, 117,  2 }, {   9, 122,  2 }, {  10, 117,  2 }, {  10, 122,  2 }, {  11, 117,  2 }, {  11, 122,  2 },
+  {  12, 117,  2 }, {  12, 122,  2 }, {  13, 117,  2 }, {  13, 122,  2 }, {  14, 117,  2 }, {  14, 122,  2 }, {  15, 117,  2 }, {  15, 122,  2 },
+  {  16, 117,  2 }, {  16, 122,  2 }, {  17, 117,  2 }, {  17, 122,  2 }, {  18, 117,  2 }, {  18, 122,  2 }, {  19, 117,  2 }, {  19, 122,  2 },
+  {  20, 117,  2 }, {  20, 122,  2 }, {  21, 117,  2 }, {  21, 122,  2 }, {  22, 117,  2 }, {  22, 122,  2 }, {  23, 117,  2 }, {  23, 122,  2 },
+  {  24, 117,  2 }, {  24, 122,  2 }, {  25, 117,  2 }, {  25, 122,  2 }, {   0, 118,  2 }, {   0, 120,  3 }, {   1, 118,  2 }, {   1, 120,  3 },
+  {   2, 118,  2 }, {   2, 120,  3 }, {   3, 118,  2 }, {   3, 120,  3 }, {   4, 118,  2 }, {   4, 120,  3 }, {   5, 118,  2 }, {   5, 120,  3 },
+  {   6, 119,  1 }, {   6, 120,  2 }, {   7, 119,  1 }, {   7, 120,  2 }, {   8, 119,  1 }, {   8, 120,  2 }, {   9, 119,  1 }, {   9, 120,  2 },
+  {  10, 119,  1 }, {  10, 120,  2 }, {  11, 119,  1 }, {  11, 120,  2 }, {  12, 119,  1 }, {  12, 120,  2 }, {  13, 119,  1 }, {  13, 120,  2 },
+  {  14, 119,  1 }, {  14, 120,  2 }, {  15, 119,  1 }, {  15, 120,  2 }, {  16, 119,  1 }, {  16, 120,  2 }, {  17, 119,  1 }, {  17, 120,  2 },
+  {  18, 119,  1 }, {  18, 120,  2 }, {  19, 119,  1 }, {  19, 120,  2 }, {  20, 119,  1 }, {  20, 120,  2 }, {  21, 119,  1 }, {  21, 120,  2 },
+  {  22, 119,  1 }, {  22, 120,  2 }, {  23, 119,  1 }, {  23, 120,  2 }, {  24, 119,  1 }, {  24, 120,  2 }, {  25, 119,  1 }, {  25, 120,  2 } };
+
+#endif  // _ARC_SPANS
@@ -0,0 +1,161 @@
+// Generate the TWAI hardware acceptance filter from CanIDs[]. Without a filter, the CAN controller raises an interrupt and queues every
+// frame on the bus, most of which we throw away. The filter compares the CAN ID of a frame against an acceptance code, ignoring the bits
+// that are set in the acceptance mask. It can be used as one 32-bit filter, or as two filters ("dual filter mode") that only compare part
+// of the frame. We pick whichever lets the fewest CAN IDs through. See "Acceptance Filter" in the ESP-IDF TWAI documentation.
+//
+// A filter can only cover standard or extended CAN IDs, so when CanIDs[] contains both, every frame is accepted, which is logged.
+
+#ifndef _CAN_ACCEPTANCE_FILTER
+#define _CAN_ACCEPTANCE_FILTER
+
+#include <stdint.h>
+#include <stddef.h>
+
+// All CAN IDs that have the bits of Code, ignoring the bits set in DontCare
+struct CanIDMatch
+{
+  uint32_t Code;
+  uint32_t DontCare;
+};
+
+struct CanAcceptanceFilter
+{
+  twai_filter_config_t Config;
+  uint64_t NumAcceptedIDs;    // Number of CAN IDs that get through the filter
+  uint64_t NumPossibleIDs;    // 2048 for standard CAN IDs, 2^29 for extended CAN IDs
+};
+
+// Number of CAN IDs of idBits bits that match
+inline uint64_t CountMatchingCanIDs(const CanIDMatch& match, const uint32_t idBits)
+{
+  return 1ull << __builtin_popcount(match.DontCare & ((1ull << idBits) - 1));
+}
+
+// Number of CAN IDs of idBits bits that match a or b
+inline uint64_t CountMatchingCanIDs(const CanIDMatch& a, const CanIDMatch& b, const uint32_t idBits)
+{
+  const uint32_t idMask = uint32_t((1ull << idBits) - 1);
+  const bool bOverlap = ((a.Code ^ b.Code) & ~a.DontCare & ~b.DontCare & idMask) == 0;
+  const uint64_t overlap = bOverlap ? (1ull << __builtin_popcount(a.DontCare & b.DontCare & idMask)) : 0;
+  return CountMatchingCanIDs(a, idBits) + CountMatchingCanIDs(b, idBits) - overlap;
+}
+
+// The smallest match that covers all IDs for which inGroup(i) is true
+template <typename InGroup>
+CanIDMatch CoverCanIDs(const uint32_t* pIDs, const size_t count, InGroup inGroup)
+{
+  CanIDMatch match = { 0, 0 };
+  bool bIsFirst = true;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    if (inGroup(i))
+    {
+      match.DontCare |= bIsFirst ? 0 : (pIDs[i] ^ match.Code);
+      match.Code = bIsFirst ? pIDs[i] : match.Code;
+      bIsFirst = false;
+    }
+  }
+
+  return match;
+}
+
+// Find the best way to split the IDs between the two filters of dual filter mode. With few IDs every split is tried, otherwise the IDs
+// are split on the most significant bit they differ in
+inline void SplitCanIDs(const uint32_t* pIDs, const size_t count, const uint32_t idBits, CanIDMatch& bestA, CanIDMatch& bestB)
+{
+  const size_t maxCountForAllSplits = 16;
+
+  bestA = bestB = CoverCanIDs(pIDs, count, [](size_t) { return true; });
+  uint64_t bestCount = CountMatchingCanIDs(bestA, idBits);
+
+  if (count > maxCountForAllSplits)
+  {
+    const uint32_t splitBit = 31 - __builtin_clz(bestA.DontCare | 1);
+    bestA = CoverCanIDs(pIDs, count, [pIDs, splitBit](size_t i) { return ((pIDs[i] >> splitBit) & 1) == 0; });
+    bestB = CoverCanIDs(pIDs, count, [pIDs, splitBit](size_t i) { return ((pIDs[i] >> splitBit) & 1) == 1; });
+    return;
+  }
+
+  // The first ID always goes to filter A, so every split is only tried once
+  for (uint32_t split = 0; split < (1u << (count - 1)) - 1; split++)
+  {
+    const uint32_t groupA = (split << 1) | 1;
+    const CanIDMatch a = CoverCanIDs(pIDs, count, [groupA](size_t i) { return ((groupA >> i) & 1) == 1; });
+    const CanIDMatch b = CoverCanIDs(pIDs, count, [groupA](size_t i) { return ((groupA >> i) & 1) == 0; });
+    const uint64_t matchCount = CountMatchingCanIDs(a, b, idBits);
+
+    if (matchCount < bestCount)
+    {
+      bestA = a;
+      bestB = b;
+      bestCount = matchCount;
+    }
+  }
+}
+
+template <size_t N>
+CanAcceptanceFilter GenerateAcceptanceFilter(const CanID (&canIDs)[N])
+{
+  uint32_t ids[N];
+  size_t numStandard = 0;
+  size_t numExtended = 0;
+
+  for (size_t i = 0; i < N; i++)
+  {
+    numStandard += (canIDs[i].ID <= MaxStandardCanID) ? 1 : 0;
+    numExtended += (canIDs[i].ID > MaxStandardCanID) ? 1 : 0;
+    ids[i] = canIDs[i].ID;
+  }
+
+  if (numStandard > 0 && numExtended > 0)
+  {
+    DebugPrintln("GenerateAcceptanceFilter: CanIDs[] mixes standard and extended CAN IDs, so every frame is accepted");
+    return { TWAI_FILTER_CONFIG_ACCEPT_ALL(), 1ull << 29, 1ull << 29 };
+  }
+
+  const bool bIsExtended = (numExtended > 0);
+  const uint32_t idBits = bIsExtended ? 29 : 11;
+
+  // Single filter mode compares the whole CAN ID
+  const CanIDMatch single = CoverCanIDs(ids, N, [](size_t) { return true; });
+  const uint64_t singleCount = CountMatchingCanIDs(single, idBits);
+
+  // Dual filter mode compares the whole ID of standard frames, but only the 16 most significant bits of extended frames
+  const uint32_t dualShift = bIsExtended ? 13 : 0;
+  uint32_t dualIDs[N];
+  for (size_t i = 0; i < N; i++)
+  {
+    dualIDs[i] = ids[i] >> dualShift;
+  }
+
+  CanIDMatch a;
+  CanIDMatch b;
+  SplitCanIDs(dualIDs, N, idBits - dualShift, a, b);
+  const uint64_t dualCount = CountMatchingCanIDs(a, b, idBits - dualShift) << dualShift;
+
+  CanAcceptanceFilter filter = { { 0, 0, true }, min(singleCount, dualCount), 1ull << idBits };
+
+  // Layout of the acceptance code and mask. Where there's an RTR bit, it's compared so only data frames are accepted. The filters of dual
+  // filter mode for extended frames only cover ID bits, so there remote frames with a matching ID get through too:
+  //    Single, standard:   [31:21] ID, [20] RTR, [15:0] data bytes 1 and 2
+  //    Single, extended:   [31:3] ID, [2] RTR
+  //    Dual, standard:     Filter 1: [31:21] ID, [20] RTR, [19:16] and [3:0] data byte 1. Filter 2: [15:5] ID, [4] RTR
+  //    Dual, extended:     Filter 1: [31:16] ID bits 28..13. Filter 2: [15:0] ID bits 28..13
+  if (singleCount <= dualCount)
+  {
+    filter.Config.single_filter = true;
+    filter.Config.acceptance_code = bIsExtended ? (single.Code << 3) : (single.Code << 21);
+    filter.Config.acceptance_mask = bIsExtended ? ((single.DontCare << 3) | 0x00000003) : ((single.DontCare << 21) | 0x000FFFFF);
+  }
+  else
+  {
+    filter.Config.single_filter = false;
+    filter.Config.acceptance_code = bIsExtended ? ((a.Code << 16) | b.Code) : ((a.Code << 21) | (b.Code << 5));
+    filter.Config.acceptance_mask = bIsExtended ? ((a.DontCare << 16) | b.DontCare) : ((a.DontCare << 21) | 0x000F000F | (b.DontCare << 5));
+  }
+
+  return filter;
+}
+
+#endif  // _CAN_ACCEPTANCE_FILTER
@@ -0,0 +1,135 @@
+// Find the CanIDs[] entry for a received CAN frame in constant time. Most frames on the HS-CAN bus are not ones we decode, so instead of
+// comparing every frame against every entry, a dispatch table is generated at compile time from the CanIDs[] definition:
+//    - Standard 11-bit CAN IDs index directly into a 2048 entry table
+//    - Extended 29-bit CAN IDs use a perfect hash, i.e. a multiplicative hash with a multiplier that was searched (at compile time) so that
+//      no two registered IDs end up in the same slot
+
+#ifndef _CAN_ID_DISPATCH
+#define _CAN_ID_DISPATCH
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Struct to define CAN IDs
+struct CanID
+{
+  char Name[64];
+  uint32_t ID;
+  int32_t (*CalculateValue)(const uint8_t* pData);
+  void (*PrintInformation)(void);
+};
+
+const uint8_t NoCanID = 0xFF;               // Returned when a CAN ID isn't in CanIDs[]
+const uint32_t MaxStandardCanID = 0x7FF;    // Standard CAN IDs are 11 bits
+
+// Slot in the perfect hash table for extended CAN IDs
+struct ExtendedCanIDSlot
+{
+  uint32_t ID;
+  uint8_t Index;
+};
+
+template <size_t ExtendedTableSize>
+struct CanIDDispatchTable
+{
+  uint8_t Standard[MaxStandardCanID + 1];       // Index into CanIDs[] for every standard CAN ID
+  ExtendedCanIDSlot Extended[ExtendedTableSize];
+  uint32_t ExtendedMultiplier;
+  uint8_t ExtendedShift;
+  bool bIsValid;                                // False if the table couldn't be generated, e.g. because of duplicate CAN IDs
+
+  constexpr uint32_t ExtendedSlot(const uint32_t id) const
+  {
+    return (ExtendedTableSize > 1) ? uint32_t(id * ExtendedMultiplier) >> ExtendedShift : 0;
+  }
+
+  // Find the index into CanIDs[] of a received frame, or NoCanID if we don't decode it
+  inline uint8_t Find(const uint32_t id, const bool bIsExtended) const
+  {
+    if (!bIsExtended)
+    {
+      return Standard[id & MaxStandardCanID];
+    }
+
+    const ExtendedCanIDSlot& slot = Extended[ExtendedSlot(id)];
+    return (slot.ID == id) ? slot.Index : NoCanID;
+  }
+};
+
+template <size_t N>
+constexpr size_t CountExtendedCanIDs(const CanID (&canIDs)[N])
+{
+  size_t count = 0;
+  for (size_t i = 0; i < N; i++)
+  {
+    count += (canIDs[i].ID > MaxStandardCanID) ? 1 : 0;
+  }
+  return count;
+}
+
+// The hash table for extended CAN IDs is a power of two with at least twice as many slots as IDs, so a perfect hash is found quickly
+template <size_t N>
+constexpr size_t ExtendedDispatchTableSize(const CanID (&canIDs)[N])
+{
+  size_t size = 1;
+  while (size < 2 * CountExtendedCanIDs(canIDs))
+  {
+    size *= 2;
+  }
+  return size;
+}
+
+template <size_t ExtendedTableSize, size_t N>
+constexpr CanIDDispatchTable<ExtendedTableSize> GenerateCanIDDispatchTable(const CanID (&canIDs)[N])
+{
+  CanIDDispatchTable<ExtendedTableSize> table {};
+  table.bIsValid = (N < NoCanID);
+
+  for (size_t i = 0; i <= MaxStandardCanID; i++)
+  {
+    table.Standard[i] = NoCanID;
+  }
+
+  for (size_t i = 0; i < N; i++)
+  {
+    if (canIDs[i].ID <= MaxStandardCanID)
+    {
+      table.bIsValid = table.bIsValid && (table.Standard[canIDs[i].ID] == NoCanID);
+      table.Standard[canIDs[i].ID] = uint8_t(i);
+    }
+  }
+
+  table.ExtendedShift = 32;
+  for (size_t size = ExtendedTableSize; size > 1; size /= 2)
+  {
+    table.ExtendedShift--;
+  }
+
+  // Try odd multipliers, starting with the golden ratio, until every extended CAN ID gets its own slot
+  bool bFoundPerfectHash = false;
+  for (uint32_t attempt = 0; attempt < 100000 && !bFoundPerfectHash; attempt++)
+  {
+    table.ExtendedMultiplier = 0x9E3779B1u + 2 * attempt;
+
+    for (size_t i = 0; i < ExtendedTableSize; i++)
+    {
+      table.Extended[i] = { 0, NoCanID };
+    }
+
+    bFoundPerfectHash = true;
+    for (size_t i = 0; i < N && bFoundPerfectHash; i++)
+    {
+      if (canIDs[i].ID > MaxStandardCanID)
+      {
+        ExtendedCanIDSlot& slot = table.Extended[table.ExtendedSlot(canIDs[i].ID)];
+        bFoundPerfectHash = (slot.Index == NoCanID);
+        slot = { canIDs[i].ID, uint8_t(i) };
+      }
+    }
+  }
+
+  table.bIsValid = table.bIsValid && bFoundPerfectHash;
+  return table;
+}
+
+#endif  // _CAN_ID_DISPATCH
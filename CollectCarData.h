@@ -10,29 +10,45 @@
 #include <ESP32-TWAI-CAN.hpp>   // TWAI = Two-Wire Automotive Interface
 #include "OBD2Calculations.h"   // Callback functions for OBD2 PIDs
 #include "OBD2Utils.h"          // Misc helper functions for OBD2
+#include "CanIDDispatch.h"      // Constant time lookup of CAN IDs
+#include "CanAcceptanceFilter.h" // Hardware filtering of CAN IDs
 
-// Struct to define CAN IDs
-struct CanID
+// CAN IDs of CAN frames that are continously broadcasted which carries encoded information without the need to send an OBD2 request
+constexpr CanID CanIDs[] = { { "Currrent Gear",  0x230,  &CalcCurrentGear, PrintCurrentGear },
+                             { "Engine RPM",     0x204,  &CalcEngineRPM,   PrintEngineRPM },
+                             { "Gearbox Mode",   0x171,  &CalcGearboxMode, PrintGearboxMode } };
+constexpr int32_t NumCanIDs = sizeof(CanIDs) / sizeof(CanIDs[0]);
+
+// Dispatch table generated from CanIDs[] at compile time, so finding the entry for a received frame costs the same no matter how many CAN IDs we decode
+constexpr auto canIDDispatch = GenerateCanIDDispatchTable<ExtendedDispatchTableSize(CanIDs)>(CanIDs);
+static_assert(canIDDispatch.bIsValid, "Failed to generate the CAN ID dispatch table, check CanIDs[] for duplicate CAN IDs");
+
+// Upper limit of frames decoded per call to CollectCarData(), so a busy bus can't hold back updates to the shared car data
+const uint32_t MaxCanFramesPerBatch = 64;
+
+// Counters to see how well batching works, frames per batch = Frames / Batches
+struct CollectCarDataStats
 {
-  char Name[64];
-  uint32_t ID;
-  int32_t (*CalculateValue)(const uint8_t* pData);
-  void (*PrintInformation)(void);
+  uint32_t Batches;             // Calls to CollectCarData() that read at least one frame
+  uint32_t Frames;              // Frames read from the RX queue
+  uint32_t MaxFramesPerBatch;
+  uint32_t Publishes;           // Updates of the car data shared with the other core, which only happen when the car data changed
 };
+CollectCarDataStats g_CollectCarDataStats { 0 };
 
-// CAN IDs of CAN frames that are continously broadcasted which carries encoded information without the need to send an OBD2 request
-const int32_t NumCanIDs = 3;
-CanID CanIDs[NumCanIDs] = { { "Currrent Gear",  0x230,  &CalcCurrentGear, PrintCurrentGear },
-                            { "Engine RPM",     0x204,  &CalcEngineRPM,   PrintEngineRPM },
-                            { "Gearbox Mode",   0x171,  &CalcGearboxMode, PrintGearboxMode } };
+// The car data that was last shared with the other core
+CarData publishedCarData { 0 };
 
 // Configuration to set SN65HVD230 in "Listen Only" mode
 twai_general_config_t listenOnlyConfig = TWAI_GENERAL_CONFIG_DEFAULT(gpio_num_t(SN65HVD230_TXPin), gpio_num_t(SN65HVD230_RXPin), TWAI_MODE_LISTEN_ONLY);
 
+// Let the TWAI controller drop frames we don't decode, instead of interrupting the CPU and queuing every frame on the bus
+CanAcceptanceFilter acceptanceFilter;
+
 // Switch SN65HVD230 to low power "Listen Only" mode
 void ListenOnlyMode_SN65HVD230()
 {
-  ESP32Can.begin(TWAI_SPEED_500KBPS, SN65HVD230_TXPin, SN65HVD230_RXPin, 0, 1024, nullptr, &listenOnlyConfig);
+  ESP32Can.begin(TWAI_SPEED_500KBPS, SN65HVD230_TXPin, SN65HVD230_RXPin, 0, 1024, &acceptanceFilter.Config, &listenOnlyConfig);
 }
 
 void SetupCollectCarData()
@@ -41,9 +57,15 @@ void SetupCollectCarData()
 
   memset(&g_CurrentCarData, 0, sizeof(g_CurrentCarData));
 
-  // Car data will be collected on ESP32-S3 core 1 and used on core 0, so we need to use a semaphore to make sure data is handled safely between the cores
-  g_SemaphoreCarData = xSemaphoreCreateBinary();
-  xSemaphoreGive(g_SemaphoreCarData);
+  acceptanceFilter = GenerateAcceptanceFilter(CanIDs);
+  DebugPrintf("CAN acceptance filter: code = %#010x, mask = %#010x, %s filter, accepts %llu of %llu CAN IDs\n", acceptanceFilter.Config.acceptance_code,
+              acceptanceFilter.Config.acceptance_mask, acceptanceFilter.Config.single_filter ? "single" : "dual",
+              (unsigned long long)acceptanceFilter.NumAcceptedIDs, (unsigned long long)acceptanceFilter.NumPossibleIDs);
+
+  // Car data will be collected on ESP32-S3 core 1 and used on core 0. g_SharedCarData makes sure the other core always sees a consistent
+  // copy, without either core ever having to wait for the other
+  g_SharedCarData.Write(g_CurrentCarData);
+  publishedCarData = g_CurrentCarData;
 
   // We don't need to send any OBD2 requests, since we're only reading broadcasted CAN frames that are already flowing between car modules
   ListenOnlyMode_SN65HVD230();
@@ -83,30 +105,25 @@ void EmulateCurrentGear()
 #endif
 }
 
-// Listen for CAN frames and process them
-void CollectCarData()
+// Decode a received CAN frame if it's one we're interested in
+inline void DecodeCanFrame(const CanFrame& receivedCANFrame)
 {
-  CanFrame receivedCANFrame;
-
-  if (ESP32Can.readFrame(receivedCANFrame), 10)
+  if (receivedCANFrame.data_length_code == 8)
   {
-    if (receivedCANFrame.data_length_code == 8)
+    const uint8_t index = canIDDispatch.Find(receivedCANFrame.identifier, receivedCANFrame.extd);
+
+    if (index != NoCanID)
     {
-      auto canID = receivedCANFrame.identifier;
-
-      for (int i = 0; i < NumCanIDs; i++)
-      {
-        if (canID == CanIDs[i].ID)
-        {
-          CanIDs[i].CalculateValue(receivedCANFrame.data);
-          //CanIDs[i].PrintInformation();
-        }
-      }
+      CanIDs[index].CalculateValue(receivedCANFrame.data);
+      //CanIDs[index].PrintInformation();
     }
   }
+}
 
-  // Update data to be shared with the other ESP32-S3 core
-  xSemaphoreTake(g_SemaphoreCarData, portMAX_DELAY);
+// Update data to be shared with the other ESP32-S3 core. The display task sleeps until it's notified, so it's only woken up when there's
+// something new to show
+void PublishCarData()
+{
   g_CurrentCarData.EngineRPM = g_EngineRPM;
   g_CurrentCarData.CurrentGear = g_CurrentGear;
   g_CurrentCarData.GearboxMode = g_GearboxMode;
@@ -117,7 +134,103 @@ void CollectCarData()
   EmulateCurrentGear();
 #endif
 
-  xSemaphoreGive(g_SemaphoreCarData);
+  if (memcmp(&g_CurrentCarData, &publishedCarData, sizeof(CarData)) == 0)
+  {
+    return;
+  }
+
+  g_SharedCarData.Write(g_CurrentCarData);
+  publishedCarData = g_CurrentCarData;
+  g_CollectCarDataStats.Publishes++;
+
+  if (g_TaskDisplayInfo)
+  {
+    xTaskNotifyGive(g_TaskDisplayInfo);
+  }
+}
+
+#ifdef DEBUG
+void PrintCollectCarDataStats()
+{
+  static AsyncTimer printTimer(10000);
+  static CollectCarDataStats lastStats { 0 };
+
+  if (!printTimer.IsActive())
+  {
+    printTimer.Start();
+  }
+
+  if (printTimer.RanOut())
+  {
+    const CollectCarDataStats& stats = g_CollectCarDataStats;
+    const uint32_t batches = stats.Batches - lastStats.Batches;
+    DebugPrintf("CAN frames: %.1f per batch (max %u), %.1f publishes/s\n", batches ? float(stats.Frames - lastStats.Frames) / batches : 0.0f,
+                stats.MaxFramesPerBatch, (stats.Publishes - lastStats.Publishes) / 10.0f);
+    lastStats = stats;
+    printTimer.Start();
+  }
+}
+#endif
+
+#ifdef DISPLAY_RPM_HISTORY
+// Sample the engine RPM for the RPM history strip at a steady rate, whether it changed or not. Every sample changes the strip, so the
+// display task is woken up for it like for new car data
+void SampleRPMHistory()
+{
+  static AsyncTimer sampleTimer(RPMHistorySampleMillis);
+
+  if (!sampleTimer.IsActive() || sampleTimer.RanOut())
+  {
+    g_RPMHistory.Write(g_CurrentCarData.EngineRPM);
+    sampleTimer.Start();
+
+    if (g_TaskDisplayInfo)
+    {
+      xTaskNotifyGive(g_TaskDisplayInfo);
+    }
+  }
+}
+#endif
+
+// Listen for CAN frames and process them. All frames waiting in the RX queue are decoded in one go, and the shared car data is only
+// published once per batch, so the other core sees updates at the rate we call this rather than the rate frames arrive at
+void CollectCarData()
+{
+  CanFrame receivedCANFrame;
+  uint32_t numFrames = 0;
+
+  // Wait a little for the first frame, then take whatever else is already in the queue without waiting
+  if (ESP32Can.readFrame(receivedCANFrame, 10))
+  {
+    do
+    {
+      DecodeCanFrame(receivedCANFrame);
+      numFrames++;
+    }
+    while (numFrames < MaxCanFramesPerBatch && ESP32Can.readFrame(receivedCANFrame, 0));
+
+    g_CollectCarDataStats.Batches++;
+    g_CollectCarDataStats.Frames += numFrames;
+    g_CollectCarDataStats.MaxFramesPerBatch = max(g_CollectCarDataStats.MaxFramesPerBatch, numFrames);
+  }
+
+#if defined(DEBUG_RPM) || defined(DEBUG_GEAR)
+  // Serial input has to be checked even when no frames arrive
+  numFrames = max(numFrames, uint32_t(1));
+#endif
+
+  if (numFrames > 0)
+  {
+    PublishCarData();
+  }
+
+#ifdef DISPLAY_RPM_HISTORY
+  SampleRPMHistory();
+#endif
+
+#ifdef DEBUG
+  PrintCollectCarDataStats();
+#endif
 }
 
 #endif  // _COLLECT_CAR_DATA
\ No newline at end of file
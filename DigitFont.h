@@ -0,0 +1,59 @@
+// FreeMonoBold54pt7b scaled down by 4, with only the glyphs of "-0123456789". Generated by "make digit-font" in the host folder, see
+// host/FontSubsetGenerator.h
+//
+// The characters from '-' to '9' that aren't listed have empty glyphs, so this is a regular GFXfont
+
+#ifndef _DIGIT_FONT
+#define _DIGIT_FONT
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+constexpr uint8_t DigitFontBitmaps[] PROGMEM = {
+  0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x01, 0xF8, 0x3F, 0xC7, 0x9E,
+  0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0x77, 0x0E, 0x79, 0xE3, 0xFC, 0x1F, 0x80, 0xF0, 0x0C, 0x07, 0xC1,
+  0xF8, 0x7F, 0x0C, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x1F, 0xF7, 0xFF, 0xFF, 0xE0, 0x0F, 0x03, 0xFC,
+  0x7F, 0xEF, 0x1E, 0xE0, 0xE4, 0x07, 0x00, 0xE0, 0x0E, 0x01, 0xC0, 0x78,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x86, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F,
+  0x03, 0xFC, 0x7F, 0xE7, 0x0E, 0x00, 0x70, 0x07, 0x00, 0xE0, 0x7C, 0x0F,
+  0x80, 0xFE, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x07, 0xC0, 0xFF, 0xFE, 0xFF,
+  0xC3, 0xF0, 0x03, 0xC0, 0xF8, 0x1F, 0x07, 0xE0, 0xFC, 0x3B, 0x8E, 0x71,
+  0xCE, 0x71, 0xCE, 0x3B, 0xFF, 0xFF, 0xF7, 0xFC, 0x07, 0x81, 0xF8, 0x3F,
+  0x7F, 0xE7, 0xFE, 0x7F, 0xC7, 0x00, 0x70, 0x07, 0xF8, 0x7F, 0xC7, 0xFE,
+  0x20, 0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x7E, 0x0F, 0xFF, 0xE7, 0xFC,
+  0x1F, 0x00, 0x03, 0xC1, 0xFC, 0x7F, 0x9E, 0x07, 0x80, 0xE0, 0x38, 0x07,
+  0x7C, 0xFF, 0xDF, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC1, 0xDC, 0x7B, 0xFE,
+  0x3F, 0xC1, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x0E, 0x00, 0xE0, 0x0C,
+  0x01, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03, 0x80, 0x30, 0x07, 0x00, 0x70,
+  0x06, 0x00, 0x60, 0x0F, 0x03, 0xFC, 0x7F, 0xE7, 0x0E, 0xE0, 0x7E, 0x07,
+  0x70, 0xE7, 0xFE, 0x3F, 0xC3, 0xFC, 0x79, 0xEE, 0x07, 0xE0, 0x7E, 0x07,
+  0x70, 0xE7, 0xFE, 0x3F, 0xC0, 0xF0, 0x0E, 0x03, 0xF8, 0x7F, 0xCF, 0x1E,
+  0xE0, 0xEE, 0x0E, 0xE0, 0xEE, 0x0F, 0x7F, 0xF7, 0xFE, 0x3E, 0xE0, 0x0E,
+  0x01, 0xE0, 0x3C, 0x07, 0x8F, 0xF0, 0xFE, 0x07, 0x80 };
+
+constexpr GFXglyph DigitFontGlyphs[] PROGMEM = {
+  {     0,  14,   3,  16,    1,   -9 },   // 0x2D '-'
+  {     0,   0,   0,  16,    0,    0 },   // 0x2E '.'
+  {     0,   0,   0,  16,    0,    0 },   // 0x2F '/'
+  {     6,  12,  18,  16,    2,  -17 },   // 0x30 '0'
+  {    33,  11,  17,  16,    3,  -17 },   // 0x31 '1'
+  {    57,  12,  17,  16,    2,  -17 },   // 0x32 '2'
+  {    83,  12,  18,  16,    2,  -17 },   // 0x33 '3'
+  {   110,  11,  16,  16,    2,  -16 },   // 0x34 '4'
+  {   132,  12,  17,  16,    2,  -16 },   // 0x35 '5'
+  {   158,  11,  18,  16,    3,  -17 },   // 0x36 '6'
+  {   183,  12,  16,  16,    2,  -16 },   // 0x37 '7'
+  {   207,  12,  18,  16,    2,  -17 },   // 0x38 '8'
+  {   234,  12,  18,  16,    3,  -17 } };   // 0x39 '9'
+
+constexpr GFXfont DigitFont PROGMEM = {
+  (uint8_t  *)DigitFontBitmaps,
+  (GFXglyph *)DigitFontGlyphs,
+  0x2D, 0x39, 27 };
+
+// Approx. 389 bytes, FreeMonoBold54pt7b is approx. 35363 bytes
+
+#endif  // _DIGIT_FONT
@@ -2,13 +2,44 @@
 #define _DISPLAY_INFO
 
 #include <Arduino_GFX_Library.h>
-#include "FreeMonoBold54pt7b.h"
+#include "GearFont.h"
+#include "DigitFont.h"
 #include "MirrorFont.h"
+#include "ArcSpans.h"
 #include "AsyncTimer.h"
+#include "DisplayTransfer.h"
+#include "GlyphTransition.h"
+#include "FramePacer.h"
+#include "FrameTiming.h"
+#include "OffscreenCanvas.h"
+#include "TileCanvas.h"
+#include "IndexedCanvas.h"
+#include "Widgets.h"
+#include "ScanlineRenderer.h"
 
 // Setup gfx library for the GC9A01 display
+#ifdef DISPLAY_SPI_DMA
+Arduino_DataBus* bus = new Arduino_ESP32SPIDMA(GC9A01_DC, GC9A01_CS, GC9A01_SCK, GC9A01_MOSI, GC9A01_MISO);
+#else
 Arduino_DataBus* bus = new Arduino_ESP32SPI(GC9A01_DC, GC9A01_CS, GC9A01_SCK, GC9A01_MOSI, GC9A01_MISO);
-Arduino_GFX* gfx = new Arduino_GC9A01(bus, GC9A01_RST, 0, true);
+#endif
+Arduino_GFX* panel = new Arduino_GC9A01(bus, GC9A01_RST, 0, true);
+
+// Everything is drawn through gfx. With DISPLAY_INDEXED_CANVAS, DISPLAY_TILE_CANVAS or DISPLAY_OFFSCREEN_CANVAS that's a copy of the
+// screen, which FlushDisplay() sends to the panel, unless there wasn't enough memory for it, see BeginDisplay()
+#if defined(DISPLAY_INDEXED_CANVAS)
+IndexedCanvas<4>* indexedCanvas = new IndexedCanvas<4>(panel);
+DisplayCanvas* canvas = indexedCanvas;
+Arduino_GFX* gfx = canvas;
+#elif defined(DISPLAY_TILE_CANVAS)
+DisplayCanvas* canvas = new TileCanvas(panel);
+Arduino_GFX* gfx = canvas;
+#elif defined(DISPLAY_OFFSCREEN_CANVAS)
+DisplayCanvas* canvas = new OffscreenCanvas(panel);
+Arduino_GFX* gfx = canvas;
+#else
+Arduino_GFX* gfx = panel;
+#endif
 bool bIsDisplayOn = false;
 
 // Define a simple shift indicator based only on RPM. It would be better to setup something using dyno numbers, looking at torque, etc.
@@ -23,21 +54,80 @@ const int32_t ShiftNowIndex = 0;  // Index into shiftIndicatorLights for ideal s
 const ShiftIndicatorLights shiftIndicatorLights[NumLights] = { {4500, RED}, {3500, YELLOW}, {2500, GREEN}, {1500, BLUE}, {0, DARKGREY} };
 
 const int32_t MaxRPM  = 6000;       // Max RPM to show on LCD
+const uint32_t TargetFramesPerSecond = 30;  // Redraw at most this often, however often the car data changes
+const uint32_t MaxFrameIntervalMs = 500;    // Redraw at least this often, even when the car data doesn't change
 const int32_t Reverse = -1;         // Define Reverse as a special gear number
 const int32_t Park    = -2;         // Define Park as a special gear number
-int32_t  previousGear = -12;        // A randomly chosen initial number
-uint16_t previousGearColor = WHITE;
 
-// g_CurrentCarData is populated by the SN65HVD230 transceiver on another ESP32-S3 core. Since the data needs to be thread safe, we keep a
-// local copy of the data on this thread, copying it safely using g_SemaphoreCarData
+// Where and how the gear is shown
+const int16_t GearTextX = 60;
+const int16_t GearTextY = 180;
+const uint8_t GearTextSize = 2;
+constexpr char GearTextCharacters[] = "PRND123456789";  // Every character GenerateGearText() can return, and the only ones in GearFont.h
+
+// True if the font has a glyph for every character in pChars
+constexpr bool FontHasGlyphs(const GFXfont& font, const GFXglyph* pGlyphs, const char* pChars)
+{
+  for (; *pChars != 0; pChars++)
+  {
+    if (uint8_t(*pChars) < font.first || uint8_t(*pChars) > font.last || pGlyphs[uint8_t(*pChars) - font.first].width == 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(FontHasGlyphs(GearFont, GearFontGlyphs, GearTextCharacters), "GearFont.h is missing gear characters, run \"make gear-font\"");
+
+// Numbers are shown with a font that's FreeMonoBold54pt7b scaled down, with only the characters a number needs
+constexpr char DigitTextCharacters[] = "-0123456789";
+const int32_t DigitFontScale = 4;
+
+static_assert(FontHasGlyphs(DigitFont, DigitFontGlyphs, DigitTextCharacters), "DigitFont.h is missing characters, run \"make digit-font\"");
+
+// If we want to display the text on a projective film as a holographic effect on the windshield, then we need to mirror the text. The
+// characters are mirrored at compile time, so the font stays in flash instead of being copied to RAM and mirrored at every boot
+#ifdef MIRROR_TEXT_FOR_HOLOGRAPHIC_REFLECTION
+constexpr FontBitmap<sizeof(GearFontBitmaps)> MirroredGearFontBitmaps PROGMEM = MirrorFontBitmap(GearFontBitmaps, GearFontGlyphs, GearFont.first,
+                                                                                                 GearTextCharacters);
+constexpr GFXfont MirroredGearFont PROGMEM = { (uint8_t*)MirroredGearFontBitmaps.Bytes, (GFXglyph*)GearFontGlyphs, GearFont.first, GearFont.last,
+                                               GearFont.yAdvance };
+const GFXfont* const pGearFont = &MirroredGearFont;
+
+constexpr FontBitmap<sizeof(DigitFontBitmaps)> MirroredDigitFontBitmaps PROGMEM = MirrorFontBitmap(DigitFontBitmaps, DigitFontGlyphs, DigitFont.first,
+                                                                                                   DigitTextCharacters);
+constexpr GFXfont MirroredDigitFont PROGMEM = { (uint8_t*)MirroredDigitFontBitmaps.Bytes, (GFXglyph*)DigitFontGlyphs, DigitFont.first, DigitFont.last,
+                                                DigitFont.yAdvance };
+const GFXfont* const pDigitFont = &MirroredDigitFont;
+const bool bMirrorText = true;
+#else
+const GFXfont* const pGearFont = &GearFont;
+const GFXfont* const pDigitFont = &DigitFont;
+const bool bMirrorText = false;
+#endif
+
+// Where the engine RPM is shown with DISPLAY_RPM_READOUT, between the gear and the bottom of the shift indicator
+const int16_t RPMReadoutX = 88;
+const int16_t RPMReadoutY = 205;
+const int32_t RPMReadoutChars = 4;
+
+// Where the engine RPM of the last seconds is shown with DISPLAY_RPM_HISTORY, one column per sample of g_RPMHistory. The strip is as wide
+// as fits between the top of the shift indicator and the tallest gear
+const int16_t RPMHistoryX = 80;
+const int16_t RPMHistoryY = 34;
+const int16_t RPMHistoryColumns = 80;
+const int16_t RPMHistoryRows = 10;
+static_assert(RPMHistoryColumns < RPMHistorySamples, "The RPM history strip shows more samples than g_RPMHistory keeps");
+
+// g_SharedCarData is populated by the SN65HVD230 transceiver on another ESP32-S3 core. Since the data needs to be thread safe, we keep a
+// local copy of the data on this thread, which g_SharedCarData guarantees is never half updated
 CarData carData;
 
 // Make a local copy of car data that was gathered on the other ESP32-S3 core
 void CopyCarData()
 {
-  xSemaphoreTake(g_SemaphoreCarData, portMAX_DELAY);
-  memcpy(&carData, &g_CurrentCarData, sizeof(CarData));
-  xSemaphoreGive(g_SemaphoreCarData);
+  g_SharedCarData.Read(carData);
 
   // If Neutral, then check if we're in Park, since we'd rather display "P" than "N" when in Park
   if (carData.CurrentGear == 0 &&
@@ -47,6 +137,125 @@ void CopyCarData()
   }
 }
 
+char GenerateGearText(const int32_t gear)
+{
+  if ((gear > 0) && (gear <= 8))
+  {
+    return '0' + gear;
+  }
+  else
+  {
+    return (gear == Park) ? 'P' : (gear == Reverse) ? 'R' : (gear == 0) ? 'N' : 'D';
+  }
+}
+
+// Color of the shift indicator for an engine RPM
+uint16_t ShiftIndicatorColor(const int32_t engineRPM)
+{
+  for (int i = 0; i < NumLights; i++)
+  {
+    if (engineRPM > shiftIndicatorLights[i].EngineRPM)
+    {
+      return shiftIndicatorLights[i].Color;
+    }
+  }
+
+  return DARKGREY;
+}
+
+// The signals the widgets show
+int32_t GearTextSignal(const CarData& carData)
+{
+  return GenerateGearText(carData.CurrentGear);
+}
+
+uint16_t GearColor(const CarData& carData)
+{
+  return (carData.EngineRPM > shiftIndicatorLights[ShiftNowIndex].EngineRPM) ? RED : WHITE;
+}
+
+#ifdef DISPLAY_INDEXED_CANVAS
+// The gear is always drawn in its own palette entry, and flashing it red only changes the color of that entry, see DrawScreen(). Unless
+// there wasn't enough memory for the canvas, and everything is drawn straight to the panel instead
+const uint16_t GearPaletteKey = 0x0821;
+
+int32_t GearColorSignal(const CarData& carData)
+{
+  return (gfx == indexedCanvas) ? GearPaletteKey : GearColor(carData);
+}
+#else
+int32_t GearColorSignal(const CarData& carData)
+{
+  return GearColor(carData);
+}
+#endif
+
+int32_t EngineRPMSignal(const CarData& carData)
+{
+  return carData.EngineRPM;
+}
+
+int32_t ShiftIndicatorColorSignal(const CarData& carData)
+{
+  return ShiftIndicatorColor(carData.EngineRPM);
+}
+
+int32_t WhiteSignal(const CarData& carData)
+{
+  return WHITE;
+}
+
+GearTextWidget gearText(pGearFont, GearTextX, GearTextY, GearTextSize, GearTextSignal, GearColorSignal);
+RingGaugeWidget shiftIndicator(MaxRPM, EngineRPMSignal, ShiftIndicatorColorSignal);
+#ifdef DISPLAY_RPM_READOUT
+NumericReadoutWidget rpmReadout(pDigitFont, RPMReadoutX, RPMReadoutY, 1, RPMReadoutChars, bMirrorText, EngineRPMSignal, WhiteSignal);
+#endif
+#ifdef DISPLAY_RPM_HISTORY
+HistoryStripWidget<RPMHistorySamples> rpmHistory(&g_RPMHistory, RPMHistoryX, RPMHistoryY, RPMHistoryColumns, RPMHistoryRows, MaxRPM, bMirrorText,
+                                                 ShiftIndicatorColor);
+#endif
+
+// What's on the screen. The widgets are drawn in this order, and each one is timed as its frame stage
+struct LayoutWidget
+{
+  Widget* pWidget;
+  FrameStage Stage;
+};
+
+const LayoutWidget ScreenLayout[] =
+{
+  { &gearText, FrameStage::GearText },
+  { &shiftIndicator, FrameStage::ShiftIndicator },
+#ifdef DISPLAY_RPM_READOUT
+  { &rpmReadout, FrameStage::Readouts },
+#endif
+#ifdef DISPLAY_RPM_HISTORY
+  { &rpmHistory, FrameStage::History },
+#endif
+};
+
+// Forget what the widgets drew, because the screen was cleared
+void InvalidateScreen()
+{
+  for (const LayoutWidget& widget : ScreenLayout)
+  {
+    widget.pWidget->Invalidate();
+  }
+}
+
+// Render every widget into a band of the screen, see ScanlineRenderer.h
+void RenderScreenRows(uint16_t* pPixels, const BandRect& band)
+{
+  for (const LayoutWidget& widget : ScreenLayout)
+  {
+    widget.pWidget->RenderRows(pPixels, band);
+  }
+}
+
+#ifdef DISPLAY_SCANLINE_RENDERER
+ScanlineRenderer scanlineRenderer;
+#endif
+
 // Turn power for display ON
 void TurnMosfetSwitchOn()
 {
@@ -63,6 +272,25 @@ void TurnMosfetSwitchOff()
   digitalWrite(MOSFET_GATE, LOW);
 }
 
+// Start the display. A canvas that can't get its memory is given up on, and from then on everything is drawn straight to the panel, like
+// without a canvas. The canvas also fails when the panel does, which then still gets retried. Returns false if the panel didn't start
+bool BeginDisplay()
+{
+#if defined(DISPLAY_INDEXED_CANVAS) || defined(DISPLAY_TILE_CANVAS) || defined(DISPLAY_OFFSCREEN_CANVAS)
+  if (gfx == canvas)
+  {
+    if (canvas->begin())
+    {
+      return true;
+    }
+
+    DebugPrintln("canvas->begin() failed! Drawing straight to the panel instead");
+    gfx = panel;
+  }
+#endif
+  return gfx->begin();
+}
+
 void TurnDisplayOn()
 {
   DebugPrintln("TurnDisplayOn()");
@@ -71,7 +299,7 @@ void TurnDisplayOn()
   TurnMosfetSwitchOn();
 
   // Init display
-  while (!gfx->begin())
+  while (!BeginDisplay())
   {
     DebugPrintln("gfx->begin() failed!");
     delay(500);
@@ -80,15 +308,28 @@ void TurnDisplayOn()
   bIsDisplayOn = true;
 
   gfx->fillScreen(RGB565_BLACK);
+  InvalidateScreen();
   gfx->setRotation(2);
-  gfx->setFont(&FreeMonoBold54pt7b);
-  gfx->setTextSize(2);
+  gfx->setFont(pGearFont);
+  gfx->setTextSize(GearTextSize);
+}
+
+// Make sure everything that was drawn is on the display
+void FlushDisplay()
+{
+#if defined(DISPLAY_INDEXED_CANVAS) || defined(DISPLAY_TILE_CANVAS) || defined(DISPLAY_OFFSCREEN_CANVAS)
+  if (gfx == canvas)
+  {
+    canvas->Flush();
+  }
+#endif
 }
 
 void TurnDisplayOff()
 {
   DebugPrintln("TurnDisplayOff()");
   gfx->fillScreen(RGB565_BLACK);
+  FlushDisplay();
   TurnMosfetSwitchOff();
   bIsDisplayOn = false;
   delay(200);
@@ -98,108 +339,100 @@ void TurnDisplayOff()
 void SetupDisplay()
 {
   DebugPrintln("SetupDisplay()");
+}
 
-  // If we want to display the text on a projective film as a holographic effect on the windshield, then we need to mirror the text
-#ifdef MIRROR_TEXT_FOR_HOLOGRAPHIC_REFLECTION
-  const uint8_t fontStartCharacter = FreeMonoBold54pt7b.first;
-
-  // Mirror text: P, R, N, 0-9 (takes only ~15ms)
-  uint16_t index = 'P' - fontStartCharacter;
-  MirrorText(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bGlyphs[index].bitmapOffset,  FreeMonoBold54pt7bGlyphs[index].width, FreeMonoBold54pt7bGlyphs[index].height);
-  index = 'R' - fontStartCharacter;
-  MirrorText(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bGlyphs[index].bitmapOffset,  FreeMonoBold54pt7bGlyphs[index].width, FreeMonoBold54pt7bGlyphs[index].height);
-  index = 'D' - fontStartCharacter;
-  MirrorText(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bGlyphs[index].bitmapOffset,  FreeMonoBold54pt7bGlyphs[index].width, FreeMonoBold54pt7bGlyphs[index].height);
-  index = 'N' - fontStartCharacter;
-  MirrorText(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bGlyphs[index].bitmapOffset,  FreeMonoBold54pt7bGlyphs[index].width, FreeMonoBold54pt7bGlyphs[index].height);
+FramePacer framePacer;
+FrameTiming frameTiming;
 
-  for (int i = 0; i < 10; i++)
+// Draw what changed on the screen since the last frame. Returns the cycle count after the last widget
+uint32_t DrawScreen(uint32_t cycles)
+{
+#ifdef DISPLAY_INDEXED_CANVAS
+  if (gfx == indexedCanvas)
   {
-    index = '0' + i - fontStartCharacter;
-    MirrorText(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bGlyphs[index].bitmapOffset,  FreeMonoBold54pt7bGlyphs[index].width, FreeMonoBold54pt7bGlyphs[index].height);
+    indexedCanvas->Recolor(GearPaletteKey, GearColor(carData));
   }
 #endif
+  for (const LayoutWidget& widget : ScreenLayout)
+  {
+    widget.pWidget->Update(gfx, carData);
+    cycles = frameTiming.Record(widget.Stage, cycles);
+  }
+  return cycles;
 }
 
-char GenerateGearText(const int32_t gear)
+// Render the whole screen in bands, if anything on it changed since the last frame. Returns the cycle count after rendering
+uint32_t RenderScreen(ScanlineRenderer& renderer, const uint32_t cycles)
 {
-  if ((gear > 0) && (gear <= 8))
+  bool bChanged = false;
+  for (const LayoutWidget& widget : ScreenLayout)
   {
-    return '0' + gear;
+    bChanged |= widget.pWidget->BeginRender(carData);
   }
-  else
+
+  if (bChanged)
   {
-    return (gear == Park) ? 'P' : (gear == Reverse) ? 'R' : (gear == 0) ? 'N' : 'D';
+    renderer.RenderFrame(RenderScreenRows);
   }
+  return frameTiming.Record(FrameStage::ScanlineBands, cycles);
 }
 
-// Clear the current gear text by redrawing it in black
-void ClearGearText(const int32_t gear)
+#ifdef DEBUG
+void PrintFramePacerStats()
 {
-  gfx->setCursor(60, 180);
-  gfx->setTextColor(RGB565_BLACK);
-  gfx->printf("%c", GenerateGearText(gear));
-}
+  static AsyncTimer printTimer(10000);
+  static FramePacerStats lastStats { 0 };
 
-void DrawGearText()
-{
-  // Determine and keep track of the gear color
-  uint16_t color = WHITE;
-  if (carData.EngineRPM > shiftIndicatorLights[ShiftNowIndex].EngineRPM)
-  {
-    color = RED;
-  }
-
-  // Update the text when the gear changes
-  if (carData.CurrentGear != previousGear)
+  if (!printTimer.IsActive())
   {
-    ClearGearText(previousGear);
-
-    // Show the new gear
-    gfx->setCursor(60, 180);
-    gfx->setTextColor(color);
-    gfx->printf("%c", GenerateGearText(carData.CurrentGear));
-
-    previousGear = carData.CurrentGear;
-    previousGearColor = color;
+    printTimer.Start();
   }
 
-  // Update the text when the gear color changes
-  if (color != previousGearColor)
+  if (printTimer.RanOut())
   {
-    // Show the current gear with the new color
-    gfx->setCursor(60, 180);
-    gfx->setTextColor(color);
-    gfx->printf("%c", GenerateGearText(carData.CurrentGear));
-
-    previousGearColor = color;
+    const FramePacerStats& stats = framePacer.Stats();
+    const uint32_t frames = stats.Frames - lastStats.Frames;
+    const float seconds = (stats.ElapsedMicros - lastStats.ElapsedMicros) / 1000000.0f;
+    DebugPrintf("Display: %.1f fps, %.1f%% busy, %u overruns, %u skipped, max frame %u us\n", frames / seconds,
+                (stats.BusyMicros - lastStats.BusyMicros) / (seconds * 10000.0f), stats.Overruns - lastStats.Overruns,
+                stats.SkippedSlots - lastStats.SkippedSlots, stats.MaxFrameMicros);
+    lastStats = stats;
+    printTimer.Start();
   }
 }
 
-void DrawShiftIndicator()
+// Print the timing of the last completed window of frames. Called from the other core, so printing never holds up the display
+void PrintFrameTiming()
 {
-  uint16_t color = DARKGREY;
+  static AsyncTimer printTimer(10000);
+  static uint32_t lastWindow = 0;
 
-  for (int i = 0; i < NumLights; i++)
+  if (!printTimer.IsActive())
   {
-    if (carData.EngineRPM > shiftIndicatorLights[i].EngineRPM)
-    {
-      color = shiftIndicatorLights[i].Color;
-      break;
-    }
+    printTimer.Start();
   }
 
-  const uint16_t rotate = 90;
-  const uint16_t endRadius = (min(MaxRPM, carData.EngineRPM) / float(MaxRPM)) * 180.0f;
-
-  // Draw left side bar
-  gfx->fillArc(120, 120, 120, 95, 0 + rotate, endRadius + rotate, color);
-  gfx->fillArc(120, 120, 120, 95, endRadius + rotate, 180 + rotate, BLACK);
+  // Copying the window takes a while, so it's only read once every time the timer runs out, whether or not there's a new one
+  if (printTimer.RanOut())
+  {
+    printTimer.Start();
 
-  // Draw right side bar
-  gfx->fillArc(120, 120, 120, 95, 360 - endRadius + rotate, 360 + rotate, color);
-  gfx->fillArc(120, 120, 120, 95, 360 - 180 + rotate, 360 - endRadius + rotate, BLACK);
+    // About 2 KB, too much for the stack of loop()
+    static FrameTimingWindow window;
+    if (frameTiming.ReadCompletedWindow(window) && window.Number != lastWindow)
+    {
+      DebugPrintf("Frame timing (us), window %u, last %u frames:\n", window.Number, window.Stages[uint32_t(FrameStage::Frame)].Count);
+      for (uint32_t i = 0; i < NumFrameStages; i++)
+      {
+        const StageHistogram& stage = window.Stages[i];
+        DebugPrintf("  %-20s min %7.1f  avg %7.1f  p99 %7.1f  max %7.1f\n", FrameStageNames[i], stage.MinNanos / 1000.0f, stage.AverageNanos() / 1000.0f,
+                    stage.PercentileNanos(0.99f) / 1000.0f, stage.MaxNanos / 1000.0f);
+      }
+      lastWindow = window.Number;
+    }
+  }
 }
+#endif
 
 // Main function of the thread task running on a seperate ESP32-S3 core
 void DisplayInfo(void* params)
@@ -208,18 +441,51 @@ void DisplayInfo(void* params)
 
   SetupDisplay();
   TurnDisplayOn();
+#ifdef DISPLAY_SCANLINE_RENDERER
+  // Without the band buffers, draw only what changed instead, like without DISPLAY_SCANLINE_RENDERER
+  const bool bRenderScanlines = scanlineRenderer.Begin(gfx, xPortGetCoreID());
+  if (!bRenderScanlines)
+  {
+    DebugPrintln("scanlineRenderer.Begin() failed! Drawing the widgets directly instead");
+  }
+#endif
+  framePacer.Begin(TargetFramesPerSecond);
 
   while (true)
   {
+    framePacer.BeginFrame();
+    const uint32_t frameStartCycles = frameTiming.Now();
+
     CopyCarData();
+    uint32_t cycles = frameTiming.Record(FrameStage::CopyCarData, frameStartCycles);
 
     if (bIsDisplayOn)
     {
-      DrawGearText();
-      DrawShiftIndicator();
+#ifdef DISPLAY_SCANLINE_RENDERER
+      if (bRenderScanlines)
+      {
+        RenderScreen(scanlineRenderer, cycles);
+      }
+      else
+      {
+        DrawScreen(cycles);
+      }
+#else
+      DrawScreen(cycles);
+#endif
+      FlushDisplay();
     }
 
-    delay(1);  // Make sure something is happening on the thread, otherwise a watchdog timer will kick in after 5 seconds and reboot device
+    frameTiming.EndFrame(frameStartCycles);
+    framePacer.EndFrame();
+
+#ifdef DEBUG
+    PrintFramePacerStats();
+#endif
+
+    // Sleep until the next frame is due and CollectCarData() has new car data for us. Blocking also lets the idle task run, so the
+    // watchdog timer doesn't reboot the device
+    framePacer.WaitForNextFrame(MaxFrameIntervalMs);
   }
 }
 
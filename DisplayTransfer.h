@@ -0,0 +1,180 @@
+// Double-buffered transfers to the display. Instead of drawing straight to the display, a renderer fills a buffer with the pixels of a
+// rectangular region and submits it. A separate task sends the buffer to the display, while the renderer fills the other buffer with
+// the next region. Arduino_GFX waits for the end of every SPI transfer by polling, so sending pixels keeps the CPU busy, with or without
+// DISPLAY_SPI_DMA. That's why the transfer task runs on the other core than the renderer: there it takes time from the loop() task that
+// collects the car data, whose frames the TWAI driver queues in the meantime, instead of from the renderer.
+//
+// Usage:
+//    uint16_t* pBuffer = pipeline.AcquireBuffer();   // Waits until one of the buffers is free
+//    ... render up to pipeline.BufferPixels() pixels into pBuffer ...
+//    pipeline.Submit(pBuffer, x, y, w, h);
+//    pipeline.Flush();                                // Before drawing to the display in any other way
+//
+// The transfer task uses the Arduino_GFX object, so nothing else may draw to the display until Flush() returns.
+
+#ifndef _DISPLAY_TRANSFER
+#define _DISPLAY_TRANSFER
+
+struct DisplayTransferStats
+{
+  uint32_t Transfers;
+  uint64_t Pixels;
+  uint64_t TransferMicros;    // Time the transfer task spent sending buffers to the display
+  uint64_t WaitMicros;        // Time the renderer spent waiting for a free buffer
+
+  // Time spent sending pixels while the renderer was busy with something else
+  uint64_t OverlapMicros() const { return (TransferMicros > WaitMicros) ? TransferMicros - WaitMicros : 0; }
+};
+
+class DisplayTransferPipeline
+{
+  public:
+    static const uint32_t NumBuffers = 2;
+
+    // Allocate the buffers in DMA capable memory and start the transfer task on the other core than renderCoreID, which the renderer runs on
+    bool Begin(Arduino_GFX* pGfx, const uint32_t bufferPixels, const BaseType_t renderCoreID)
+    {
+      m_pGfx = pGfx;
+      m_bufferPixels = bufferPixels;
+      m_nextBuffer = 0;
+      memset(&m_stats, 0, sizeof(m_stats));
+
+      for (uint32_t i = 0; i < NumBuffers; i++)
+      {
+        m_pBuffers[i] = (uint16_t*)heap_caps_malloc(bufferPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if (m_pBuffers[i] == nullptr)
+        {
+          DebugPrintln("DisplayTransferPipeline: Failed to allocate buffers");
+          End();
+          return false;
+        }
+      }
+
+      m_transfers = xQueueCreate(NumBuffers, sizeof(Transfer));
+      m_freeBuffers = xSemaphoreCreateCounting(NumBuffers, NumBuffers);
+      if (m_transfers == nullptr || m_freeBuffers == nullptr)
+      {
+        DebugPrintln("DisplayTransferPipeline: Failed to create the queue or semaphore");
+        End();
+        return false;
+      }
+
+      // A higher priority than loop(), so a submitted buffer is sent right away
+      if (xTaskCreatePinnedToCore(TransferTask, "DisplayTransfer", 1024 * 4, this, 2, &m_task, 1 - renderCoreID) != pdPASS)
+      {
+        DebugPrintln("DisplayTransferPipeline: Failed to start the transfer task");
+        m_task = nullptr;
+        End();
+        return false;
+      }
+      return true;
+    }
+
+    void End()
+    {
+      if (m_task)
+      {
+        Flush();
+        vTaskDelete(m_task);
+        m_task = nullptr;
+      }
+
+      if (m_transfers)
+      {
+        vQueueDelete(m_transfers);
+        m_transfers = nullptr;
+      }
+
+      if (m_freeBuffers)
+      {
+        vSemaphoreDelete(m_freeBuffers);
+        m_freeBuffers = nullptr;
+      }
+
+      for (uint32_t i = 0; i < NumBuffers; i++)
+      {
+        heap_caps_free(m_pBuffers[i]);
+        m_pBuffers[i] = nullptr;
+      }
+    }
+
+    // The buffers are used in turn, and transfers finish in the order they were submitted
+    uint16_t* AcquireBuffer()
+    {
+      const unsigned long startMicros = micros();
+      xSemaphoreTake(m_freeBuffers, portMAX_DELAY);
+      m_stats.WaitMicros += micros() - startMicros;
+
+      uint16_t* pBuffer = m_pBuffers[m_nextBuffer];
+      m_nextBuffer = (m_nextBuffer + 1) % NumBuffers;
+      return pBuffer;
+    }
+
+    void Submit(uint16_t* pBuffer, const int16_t x, const int16_t y, const int16_t w, const int16_t h)
+    {
+      const Transfer transfer = { pBuffer, x, y, w, h };
+      m_stats.Transfers++;
+      m_stats.Pixels += uint32_t(w) * h;
+      xQueueSend(m_transfers, &transfer, portMAX_DELAY);
+    }
+
+    // Wait until all submitted buffers have been sent
+    void Flush()
+    {
+      const unsigned long startMicros = micros();
+      for (uint32_t i = 0; i < NumBuffers; i++)
+      {
+        xSemaphoreTake(m_freeBuffers, portMAX_DELAY);
+      }
+      m_stats.WaitMicros += micros() - startMicros;
+
+      for (uint32_t i = 0; i < NumBuffers; i++)
+      {
+        xSemaphoreGive(m_freeBuffers);
+      }
+    }
+
+    inline uint32_t BufferPixels() const { return m_bufferPixels; }
+
+    // Only complete after Flush()
+    inline const DisplayTransferStats& Stats() const { return m_stats; }
+
+  private:
+    struct Transfer
+    {
+      uint16_t* pBuffer;
+      int16_t X;
+      int16_t Y;
+      int16_t W;
+      int16_t H;
+    };
+
+    static void TransferTask(void* params)
+    {
+      DisplayTransferPipeline* pPipeline = (DisplayTransferPipeline*)params;
+      Transfer transfer;
+
+      while (true)
+      {
+        if (xQueueReceive(pPipeline->m_transfers, &transfer, portMAX_DELAY))
+        {
+          const unsigned long startMicros = micros();
+          pPipeline->m_pGfx->draw16bitRGBBitmap(transfer.X, transfer.Y, transfer.pBuffer, transfer.W, transfer.H);
+          pPipeline->m_stats.TransferMicros += micros() - startMicros;
+
+          xSemaphoreGive(pPipeline->m_freeBuffers);
+        }
+      }
+    }
+
+    Arduino_GFX* m_pGfx = nullptr;
+    uint16_t* m_pBuffers[NumBuffers] = { nullptr };
+    uint32_t m_bufferPixels = 0;
+    uint32_t m_nextBuffer = 0;
+    QueueHandle_t m_transfers = nullptr;
+    SemaphoreHandle_t m_freeBuffers = nullptr;
+    TaskHandle_t m_task = nullptr;
+    DisplayTransferStats m_stats = { 0 };
+};
+
+#endif  // _DISPLAY_TRANSFER
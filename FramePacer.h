@@ -0,0 +1,115 @@
+// Paces the frames of the display task to a target frame rate. Time is divided into slots of one frame period, and a frame starts at the
+// beginning of a slot at the earliest, so new car data that arrives in quick succession is drawn at most once per slot. A frame has to
+// finish before the end of its slot, its deadline. A frame that overruns its deadline skips the slots it ran into, and the next frame
+// starts at the first slot after it finished, so the display task never tries to catch up by drawing frames back to back.
+//
+// Usage:
+//    pacer.BeginFrame();
+//    ... draw ...
+//    pacer.EndFrame();
+//    pacer.WaitForNextFrame(maxIntervalMs);
+
+#ifndef _FRAME_PACER
+#define _FRAME_PACER
+
+struct FramePacerStats
+{
+  uint32_t Frames;
+  uint32_t Overruns;            // Frames that didn't finish before their deadline
+  uint32_t SkippedSlots;        // Slots that were lost to overruns
+  uint32_t MaxFrameMicros;
+  uint64_t BusyMicros;          // Time spent between BeginFrame() and EndFrame()
+  uint64_t ElapsedMicros;       // Time since Begin(), as of the last call to FramePacer::Stats()
+
+  float FramesPerSecond() const { return ElapsedMicros ? Frames * 1000000.0f / ElapsedMicros : 0.0f; }
+
+  // Fraction of the time spent drawing frames [0..1]
+  float Load() const { return ElapsedMicros ? float(BusyMicros) / ElapsedMicros : 0.0f; }
+};
+
+class FramePacer
+{
+  public:
+    void Begin(const uint32_t targetFramesPerSecond)
+    {
+      m_periodMicros = 1000000 / max(targetFramesPerSecond, uint32_t(1));
+      m_statsMicros = micros();
+      m_nextSlotMicros = m_statsMicros;
+      m_frameSlotMicros = m_statsMicros;
+      m_frameStartMicros = m_statsMicros;
+      memset(&m_stats, 0, sizeof(m_stats));
+    }
+
+    void BeginFrame()
+    {
+      const uint32_t now = micros();
+
+      // After being idle for more than a slot, the slots start over from now
+      if (int32_t(now - m_nextSlotMicros) >= int32_t(m_periodMicros))
+      {
+        m_nextSlotMicros = now;
+      }
+
+      m_frameSlotMicros = m_nextSlotMicros;
+      m_frameStartMicros = now;
+    }
+
+    void EndFrame()
+    {
+      const uint32_t now = micros();
+      const uint32_t frameMicros = now - m_frameStartMicros;
+      const uint32_t deadline = m_frameSlotMicros + m_periodMicros;
+
+      m_stats.Frames++;
+      m_stats.BusyMicros += frameMicros;
+      m_stats.MaxFrameMicros = max(m_stats.MaxFrameMicros, frameMicros);
+
+      if (int32_t(now - deadline) > 0)
+      {
+        // Skip to the first slot that starts after now
+        const uint32_t skippedSlots = (now - deadline + m_periodMicros - 1) / m_periodMicros;
+        m_stats.Overruns++;
+        m_stats.SkippedSlots += skippedSlots;
+        m_nextSlotMicros = deadline + skippedSlots * m_periodMicros;
+      }
+      else
+      {
+        m_nextSlotMicros = deadline;
+      }
+    }
+
+    // Sleep until the next slot starts, then until the task is notified that there's something new to draw, or until maxIntervalMs has
+    // passed since the last frame started. Notifications that arrive before the next slot are remembered, not lost
+    void WaitForNextFrame(const uint32_t maxIntervalMs)
+    {
+      const int32_t untilNextSlot = int32_t(m_nextSlotMicros - micros());
+      if (untilNextSlot > 0)
+      {
+        vTaskDelay(pdMS_TO_TICKS((untilNextSlot + 999) / 1000));
+      }
+
+      const uint32_t sinceFrameMs = (micros() - m_frameStartMicros) / 1000;
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS((sinceFrameMs < maxIntervalMs) ? maxIntervalMs - sinceFrameMs : 0));
+    }
+
+    inline uint32_t PeriodMicros() const { return m_periodMicros; }
+
+    // Has to be called at least once every 71 minutes, when micros() wraps around
+    const FramePacerStats& Stats()
+    {
+      const uint32_t now = micros();
+      m_stats.ElapsedMicros += now - m_statsMicros;
+      m_statsMicros = now;
+      return m_stats;
+    }
+
+  private:
+    uint32_t m_periodMicros = 0;
+    uint32_t m_statsMicros = 0;
+    uint32_t m_nextSlotMicros = 0;     // The slot the next frame starts in at the earliest
+    uint32_t m_frameSlotMicros = 0;    // The slot of the current frame
+    uint32_t m_frameStartMicros = 0;
+    FramePacerStats m_stats = { 0 };
+};
+
+#endif  // _FRAME_PACER
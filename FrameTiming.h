@@ -0,0 +1,195 @@
+// Per-stage timing of the display task. The time every stage of a frame takes is measured with the CPU cycle counter and added to a
+// histogram, which gives the min, average and 99th percentile without keeping every sample. The histograms cover a rolling window of the
+// last WindowFrames frames. It's made of a ring of SubWindows sub-windows of SubWindowFrames frames each: every time a sub-window
+// completes, the sub-windows are summed up and published through a SeqLock, and the oldest one is cleared to collect the next frames.
+// So another core can print the last WindowFrames frames at any time without ever making the display task wait, and what it prints is
+// never more than SubWindowFrames frames old.
+//
+// Usage on the display task:
+//    uint32_t cycles = frameTiming.Now();
+//    CopyCarData();
+//    cycles = frameTiming.Record(FrameStage::CopyCarData, cycles);
+//    ...
+//    frameTiming.EndFrame(frameStartCycles);
+//
+// On the host, ESP.getCycleCount() is based on a monotonic clock instead of a cycle counter.
+
+#ifndef _FRAME_TIMING
+#define _FRAME_TIMING
+
+#include "SeqLock.h"
+
+enum class FrameStage : uint32_t
+{
+  CopyCarData,
+  GearText,
+  ShiftIndicator,
+  Readouts,
+  History,
+  ScanlineBands,          // Rendering the whole screen with DISPLAY_SCANLINE_RENDERER, instead of the widget stages
+  Frame,                  // The whole frame, from BeginFrame() to EndFrame() of the frame pacer
+  Count
+};
+
+const char* const FrameStageNames[] = { "CopyCarData()", "Gear text", "Shift indicator", "Readouts", "History", "Scanline bands", "Frame" };
+constexpr uint32_t NumFrameStages = uint32_t(FrameStage::Count);
+
+// Histogram of durations in nanoseconds. The buckets are a quarter of a power of two wide, so a percentile is at most 25% too high
+struct StageHistogram
+{
+  static constexpr uint32_t SubBuckets = 4;
+  static constexpr uint32_t NumBuckets = 32 * SubBuckets;
+
+  uint32_t Count;
+  uint32_t MinNanos;
+  uint32_t MaxNanos;
+  uint32_t Padding;
+  uint64_t SumNanos;
+  uint16_t Buckets[NumBuckets];
+
+  static uint32_t Bucket(const uint32_t nanos)
+  {
+    // Too short to split up, so every duration gets its own bucket
+    if (nanos < 2 * SubBuckets)
+    {
+      return nanos;
+    }
+
+    // The power of two, and the next two bits below the highest set bit
+    const uint32_t log2 = 31 - __builtin_clz(nanos);
+    return log2 * SubBuckets + ((nanos >> (log2 - 2)) & (SubBuckets - 1));
+  }
+
+  // The largest duration that falls in a bucket
+  static uint32_t BucketMaxNanos(const uint32_t bucket)
+  {
+    if (bucket < 2 * SubBuckets)
+    {
+      return bucket;
+    }
+
+    const uint32_t log2 = bucket / SubBuckets;
+    const uint64_t maxNanos = (uint64_t((SubBuckets + bucket % SubBuckets + 1)) << (log2 - 2)) - 1;
+    return uint32_t(min<uint64_t>(maxNanos, UINT32_MAX));
+  }
+
+  void Add(const uint32_t nanos)
+  {
+    MinNanos = (Count == 0) ? nanos : min(MinNanos, nanos);
+    MaxNanos = max(MaxNanos, nanos);
+    SumNanos += nanos;
+    Count++;
+
+    uint16_t& bucket = Buckets[Bucket(nanos)];
+    bucket = (bucket < UINT16_MAX) ? bucket + 1 : bucket;
+  }
+
+  // Add the samples of another histogram
+  void Merge(const StageHistogram& other)
+  {
+    if (other.Count == 0)
+    {
+      return;
+    }
+
+    MinNanos = (Count == 0) ? other.MinNanos : min(MinNanos, other.MinNanos);
+    MaxNanos = max(MaxNanos, other.MaxNanos);
+    SumNanos += other.SumNanos;
+    Count += other.Count;
+
+    for (uint32_t i = 0; i < NumBuckets; i++)
+    {
+      Buckets[i] = uint16_t(min<uint32_t>(uint32_t(Buckets[i]) + other.Buckets[i], UINT16_MAX));
+    }
+  }
+
+  uint32_t AverageNanos() const { return Count ? uint32_t(SumNanos / Count) : 0; }
+
+  // The duration that fraction [0..1] of the samples doesn't exceed, rounded up to the end of its bucket
+  uint32_t PercentileNanos(const float fraction) const
+  {
+    const uint32_t rank = uint32_t(ceilf(fraction * Count));
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < NumBuckets; i++)
+    {
+      count += Buckets[i];
+      if (count >= rank && count > 0)
+      {
+        return min(BucketMaxNanos(i), MaxNanos);
+      }
+    }
+    return MaxNanos;
+  }
+};
+
+struct FrameTimingWindow
+{
+  uint32_t Number;        // Counts the published windows, 0 if none has been published yet
+  uint32_t Padding;
+  StageHistogram Stages[NumFrameStages];
+};
+
+class FrameTiming
+{
+  public:
+    static const uint32_t SubWindows = 4;
+    static const uint32_t SubWindowFrames = 32;
+    static const uint32_t WindowFrames = SubWindows * SubWindowFrames;
+
+    inline uint32_t Now() const { return ESP.getCycleCount(); }
+
+    // Add the time since startCycles to the stage. Returns the current cycle count, which is where the next stage starts
+    uint32_t Record(const FrameStage stage, const uint32_t startCycles)
+    {
+      const uint32_t now = Now();
+      m_subWindows[m_subWindow][uint32_t(stage)].Add(CyclesToNanos(now - startCycles));
+      return now;
+    }
+
+    // Record the whole frame, and publish the window when a sub-window is complete
+    void EndFrame(const uint32_t frameStartCycles)
+    {
+      Record(FrameStage::Frame, frameStartCycles);
+
+      if (m_subWindows[m_subWindow][uint32_t(FrameStage::Frame)].Count >= SubWindowFrames)
+      {
+        // Until all the sub-windows have been filled once, the window covers fewer frames
+        memset(&m_window, 0, sizeof(m_window));
+        m_window.Number = ++m_numWindows;
+        for (uint32_t i = 0; i < SubWindows; i++)
+        {
+          for (uint32_t stage = 0; stage < NumFrameStages; stage++)
+          {
+            m_window.Stages[stage].Merge(m_subWindows[i][stage]);
+          }
+        }
+        m_completed.Write(m_window);
+
+        // The oldest sub-window makes room for the next frames
+        m_subWindow = (m_subWindow + 1) % SubWindows;
+        memset(m_subWindows[m_subWindow], 0, sizeof(m_subWindows[m_subWindow]));
+      }
+    }
+
+    // Can be called from any core. Returns false if no window has been published yet. The Frame stage counts the frames in the window
+    bool ReadCompletedWindow(FrameTimingWindow& window) const
+    {
+      m_completed.Read(window);
+      return window.Number > 0;
+    }
+
+  private:
+    // The clock can change, e.g. in power save mode, so cycles are converted right away
+    static uint32_t CyclesToNanos(const uint32_t cycles)
+    {
+      return uint32_t(uint64_t(cycles) * 1000 / max(getCpuFrequencyMhz(), uint32_t(1)));
+    }
+
+    StageHistogram m_subWindows[SubWindows][NumFrameStages] = {};
+    uint32_t m_subWindow = 0;
+    uint32_t m_numWindows = 0;
+    FrameTimingWindow m_window = { 0 };     // The sum of the sub-windows, kept here rather than on the stack of the display task
+    SeqLock<FrameTimingWindow> m_completed;
+};
+
+#endif  // _FRAME_TIMING
@@ -16,7 +16,7 @@
 #define PROGMEM
 #endif
 
-/*const*/ uint8_t FreeMonoBold54pt7bBitmaps[] PROGMEM = {
+constexpr uint8_t FreeMonoBold54pt7bBitmaps[] PROGMEM = {
   0x00, 0x01, 0xC0, 0x07, 0xFC, 0x07, 0xFF, 0x07, 0xFF, 0xC7, 0xFF, 0xF3,
   0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0x7F,
@@ -2900,7 +2900,7 @@
   0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00 };
 
-const GFXglyph FreeMonoBold54pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph FreeMonoBold54pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,  64,    0,    0 },   // 0x20 ' '
   {     1,  17,  70,  64,   23,  -67 },   // 0x21 '!'
   {   150,  34,  31,  64,   14,  -63 },   // 0x22 '"'
@@ -2997,7 +2997,7 @@ const GFXglyph FreeMonoBold54pt7bGlyphs[] PROGMEM = {
   { 34113,  32,  82,  64,   17,  -65 },   // 0x7D '}'
   { 34441,  50,  22,  64,    7,  -40 } }; // 0x7E '~'
 
-const GFXfont FreeMonoBold54pt7b PROGMEM = {
+constexpr GFXfont FreeMonoBold54pt7b PROGMEM = {
   (uint8_t  *)FreeMonoBold54pt7bBitmaps,
   (GFXglyph *)FreeMonoBold54pt7bGlyphs,
   0x20, 0x7E, 106 };
@@ -0,0 +1,512 @@
+// FreeMonoBold54pt7b with only the glyphs of "PRND123456789". Generated by "make gear-font" in the host folder, see
+// host/FontSubsetGenerator.h
+//
+// The characters from '1' to 'R' that aren't listed have empty glyphs, so this is a regular GFXfont
+
+#ifndef _GEAR_FONT
+#define _GEAR_FONT
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+constexpr uint8_t GearFontBitmaps[] PROGMEM = {
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
+  0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0x00,
+  0x00, 0x7F, 0xFE, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xC0, 0x00,
+  0x1F, 0xFC, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x03,
+  0xF8, 0x03, 0xFF, 0x80, 0x00, 0x0F, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xE0, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x3F,
+  0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x7F,
+  0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x7F,
+  0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x3F,
+  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x0F,
+  0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0xF8, 0x0F,
+  0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x7F,
+  0xFF, 0x80, 0x00, 0x07, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFE, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+  0xC0, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0xFF,
+  0xF0, 0x0F, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x1F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+  0x3F, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+  0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+  0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xEF,
+  0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xE3, 0xFF,
+  0x80, 0x00, 0x0F, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0,
+  0x00, 0x07, 0xFF, 0x87, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 0x00,
+  0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x3F, 0xFC, 0x0F, 0xFE, 0x00, 0x01,
+  0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x01, 0xFF,
+  0xE0, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0,
+  0x07, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF0, 0x01,
+  0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x7F,
+  0xF0, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x1F, 0xFC,
+  0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00,
+  0xFF, 0xE0, 0x00, 0x3F, 0xF8, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
+  0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+  0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFE,
+  0x00, 0x00, 0x07, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xC0, 0x01,
+  0xFF, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0xF0, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0x80, 0x00, 0x00,
+  0x3F, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xF0, 0x00, 0x01,
+  0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF,
+  0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xE0, 0x1F,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xE0, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
+  0x87, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFC,
+  0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFB, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xEF,
+  0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x3F, 0xFF, 0xF8,
+  0x00, 0xFF, 0xFC, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0xFF, 0xFF, 0x00,
+  0x00, 0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xF0, 0x00,
+  0x00, 0xFF, 0xE7, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0x80, 0x00,
+  0x03, 0xFF, 0xCF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x9F, 0xFC, 0x00, 0x00,
+  0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF8, 0x00, 0x00,
+  0x1F, 0xFC, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x00,
+  0x7F, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x03,
+  0xFF, 0xC3, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0x80, 0x00, 0x1F,
+  0xFE, 0x0F, 0xFF, 0x80, 0x00, 0x3F, 0xFC, 0x0F, 0xFF, 0x80, 0x00, 0xFF,
+  0xF8, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xE7, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0x87, 0xC0, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+  0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x3F,
+  0xFF, 0x80, 0x07, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xC3, 0xFF,
+  0xC0, 0x00, 0x0F, 0xFF, 0x1F, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xF8,
+  0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x00,
+  0x00, 0x03, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00,
+  0x00, 0x3F, 0xF9, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x00, 0x00,
+  0x03, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x00,
+  0x7F, 0xF0, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xC1, 0xFF, 0xE0, 0x00, 0x1F,
+  0xFE, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x7F, 0xFE,
+  0x00, 0x1F, 0xFF, 0x83, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x1F, 0xFF, 0x00,
+  0x00, 0x3F, 0xFE, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xC0, 0x00,
+  0x00, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
+  0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x1F, 0xFE,
+  0x7F, 0xFE, 0x00, 0x01, 0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE3,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x7F,
+  0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x7F,
+  0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x7F,
+  0xF0, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+  0xE3, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+  0x8F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x9F, 0xFC, 0x00, 0x00, 0x07, 0xFF,
+  0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC,
+  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF1,
+  0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xE7,
+  0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
+  0xFF, 0xFF, 0xFD, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x3F,
+  0xFF, 0xFF, 0xCF, 0xFE, 0x00, 0x3F, 0xFF, 0xFE, 0x1F, 0xFC, 0x00, 0x1F,
+  0xFF, 0xF8, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x03,
+  0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xF8, 0x00, 0x3E, 0x01, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x0F,
+  0xFF, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFC,
+  0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0,
+  0x07, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x00,
+  0x7F, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xE0,
+  0x3F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+  0x3F, 0xF8, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0x00,
+  0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x81,
+  0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00,
+  0x00, 0x00, 0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x00,
+  0x00, 0x01, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F,
+  0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x0F, 0xFE, 0x00, 0x00,
+  0x00, 0x0F, 0xFE, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF,
+  0x80, 0x00, 0x00, 0x07, 0xFF, 0x81, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF,
+  0x80, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x00,
+  0x01, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x1F, 0xFC,
+  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+  0x07, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0x80, 0x00, 0x01,
+  0xFF, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0x00, 0x1F,
+  0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xF7, 0xFF,
+  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x0F, 0xFF,
+  0xFE, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
+  0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+  0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
+  0x80, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+  0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFC,
+  0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFD, 0xFF,
+  0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFB, 0xFF, 0xF0, 0x00, 0xFF, 0xE0,
+  0x00, 0x7F, 0xF3, 0xFF, 0xE0, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0xE3, 0xFF,
+  0xE0, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC7, 0xFF, 0xE0, 0x07, 0xFF, 0x00,
+  0x03, 0xFF, 0x87, 0xFF, 0xC0, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x07, 0xFF,
+  0xC0, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x0F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
+  0x1F, 0xFC, 0x0F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x3F, 0xF8, 0x0F, 0xFF,
+  0x80, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x81, 0xFF, 0xC0, 0x00,
+  0xFF, 0xE0, 0x1F, 0xFF, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x1F, 0xFF,
+  0x07, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x3F, 0xFE, 0x0F, 0xFE, 0x00, 0x07,
+  0xFF, 0x00, 0x3F, 0xFE, 0x1F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x3F, 0xFE,
+  0x3F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFC, 0x7F, 0xF0, 0x00, 0x3F,
+  0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFD,
+  0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFB, 0xFF, 0x80, 0x01, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
+  0xFE, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE,
+  0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0xFF,
+  0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
+  0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
+  0x80, 0x01, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFC,
+  0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xE0,
+  0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC,
+  0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+  0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
+  0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF8,
+  0x03, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x0F, 0xFE,
+  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0x00,
+  0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+  0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00,
+  0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0x80,
+  0x00, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x3F,
+  0xF8, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xF0,
+  0x03, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03,
+  0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0x3F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F,
+  0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x3F,
+  0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07,
+  0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
+  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+  0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
+  0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFC, 0x7F,
+  0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xF0, 0x00,
+  0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8 };
+
+constexpr GFXglyph GearFontGlyphs[] PROGMEM = {
+  {     0,  45,  67,  64,   10,  -66 },   // 0x31 '1'
+  {   377,  48,  68,  64,    7,  -67 },   // 0x32 '2'
+  {   785,  49,  70,  64,    7,  -67 },   // 0x33 '3'
+  {  1214,  45,  66,  64,    9,  -65 },   // 0x34 '4'
+  {  1586,  48,  68,  64,    8,  -65 },   // 0x35 '5'
+  {  1994,  47,  70,  64,   11,  -67 },   // 0x36 '6'
+  {  2406,  46,  66,  64,    8,  -65 },   // 0x37 '7'
+  {  2786,  46,  70,  64,    9,  -67 },   // 0x38 '8'
+  {  3189,  47,  70,  64,   11,  -67 },   // 0x39 '9'
+  {     0,   0,   0,  64,    0,    0 },   // 0x3A ':'
+  {     0,   0,   0,  64,    0,    0 },   // 0x3B ';'
+  {     0,   0,   0,  64,    0,    0 },   // 0x3C '<'
+  {     0,   0,   0,  64,    0,    0 },   // 0x3D '='
+  {     0,   0,   0,  64,    0,    0 },   // 0x3E '>'
+  {     0,   0,   0,  64,    0,    0 },   // 0x3F '?'
+  {     0,   0,   0,  64,    0,    0 },   // 0x40 '@'
+  {     0,   0,   0,  64,    0,    0 },   // 0x41 'A'
+  {     0,   0,   0,  64,    0,    0 },   // 0x42 'B'
+  {     0,   0,   0,  64,    0,    0 },   // 0x43 'C'
+  {  3601,  57,  62,  64,    2,  -61 },   // 0x44 'D'
+  {     0,   0,   0,  64,    0,    0 },   // 0x45 'E'
+  {     0,   0,   0,  64,    0,    0 },   // 0x46 'F'
+  {     0,   0,   0,  64,    0,    0 },   // 0x47 'G'
+  {     0,   0,   0,  64,    0,    0 },   // 0x48 'H'
+  {     0,   0,   0,  64,    0,    0 },   // 0x49 'I'
+  {     0,   0,   0,  64,    0,    0 },   // 0x4A 'J'
+  {     0,   0,   0,  64,    0,    0 },   // 0x4B 'K'
+  {     0,   0,   0,  64,    0,    0 },   // 0x4C 'L'
+  {     0,   0,   0,  64,    0,    0 },   // 0x4D 'M'
+  {  4043,  63,  62,  64,    0,  -61 },   // 0x4E 'N'
+  {     0,   0,   0,  64,    0,    0 },   // 0x4F 'O'
+  {  4532,  54,  62,  64,    2,  -61 },   // 0x50 'P'
+  {     0,   0,   0,  64,    0,    0 },   // 0x51 'Q'
+  {  4951,  64,  62,  64,    0,  -61 } };   // 0x52 'R'
+
+constexpr GFXfont GearFont PROGMEM = {
+  (uint8_t  *)GearFontBitmaps,
+  (GFXglyph *)GearFontGlyphs,
+  0x31, 0x52, 106 };
+
+// Approx. 5743 bytes, FreeMonoBold54pt7b is approx. 35363 bytes
+
+#endif  // _GEAR_FONT
@@ -0,0 +1,76 @@
+// Replace one character of a GFXfont on the display by another, drawn at the same cursor position, by only writing the pixels that
+// change. Pixels that are set in both characters keep their color, so unless the color changes too, most of the character isn't touched
+// at all and nothing is erased first, which is what made the gear flicker.
+//
+// The pixels that change are sent as horizontal spans, one filled rectangle per span, instead of one rectangle per pixel.
+
+#ifndef _GLYPH_TRANSITION
+#define _GLYPH_TRANSITION
+
+// True if pixel x,y of the glyph is set, where x,y is relative to the cursor, in font pixels
+inline bool IsGlyphPixelSet(const GFXfont& font, const GFXglyph& glyph, const int16_t x, const int16_t y)
+{
+  const int16_t column = x - glyph.xOffset;
+  const int16_t row = y - glyph.yOffset;
+  if (column < 0 || column >= glyph.width || row < 0 || row >= glyph.height)
+  {
+    return false;
+  }
+
+  const uint32_t pixel = uint32_t(row) * glyph.width + column;
+  return (font.bitmap[glyph.bitmapOffset + pixel / 8] & (0x80 >> (pixel % 8))) != 0;
+}
+
+// Change character oldC in oldColor into c in color, with the cursor at cursorX,cursorY and the given text size. Returns the number of
+// pixels written
+inline uint32_t DrawGlyphTransition(Arduino_GFX* pGfx, const GFXfont& font, const char oldC, const uint16_t oldColor, const char c, const uint16_t color,
+                                    const int16_t cursorX, const int16_t cursorY, const uint8_t textSize)
+{
+  const GFXglyph& oldGlyph = font.glyph[uint8_t(oldC) - font.first];
+  const GFXglyph& glyph = font.glyph[uint8_t(c) - font.first];
+  const bool bRecolor = (color != oldColor);
+
+  // Both glyphs, in font pixels relative to the cursor
+  const int16_t left = min<int16_t>(oldGlyph.xOffset, glyph.xOffset);
+  const int16_t top = min<int16_t>(oldGlyph.yOffset, glyph.yOffset);
+  const int16_t right = max<int16_t>(oldGlyph.xOffset + oldGlyph.width, glyph.xOffset + glyph.width);
+  const int16_t bottom = max<int16_t>(oldGlyph.yOffset + oldGlyph.height, glyph.yOffset + glyph.height);
+
+  enum class Change { None, Set, Clear };
+  uint32_t numPixels = 0;
+
+  pGfx->startWrite();
+  for (int16_t y = top; y < bottom; y++)
+  {
+    Change spanChange = Change::None;
+    int16_t spanStart = left;
+
+    for (int16_t x = left; x <= right; x++)
+    {
+      Change change = Change::None;
+      if (x < right)
+      {
+        const bool bWasSet = IsGlyphPixelSet(font, oldGlyph, x, y);
+        const bool bIsSet = IsGlyphPixelSet(font, glyph, x, y);
+        change = (bIsSet && (!bWasSet || bRecolor)) ? Change::Set : (bWasSet && !bIsSet) ? Change::Clear : Change::None;
+      }
+
+      if (change != spanChange)
+      {
+        if (spanChange != Change::None)
+        {
+          pGfx->writeFillRect(cursorX + spanStart * textSize, cursorY + y * textSize, (x - spanStart) * textSize, textSize,
+                              (spanChange == Change::Set) ? color : BLACK);
+          numPixels += uint32_t(x - spanStart) * textSize * textSize;
+        }
+        spanChange = change;
+        spanStart = x;
+      }
+    }
+  }
+  pGfx->endWrite();
+
+  return numPixels;
+}
+
+#endif  // _GLYPH_TRANSITION
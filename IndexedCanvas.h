@@ -0,0 +1,241 @@
+// An offscreen canvas that stores a palette index of BitsPerPixel bits for every pixel instead of its RGB565 color, see
+// DISPLAY_INDEXED_CANVAS. The screen only uses a handful of colors, so with 4 bits per pixel the canvas takes a quarter of the memory
+// of a 16 bit one, 28.8 KB, which fits in internal RAM. The indices are expanded to RGB565 in Flush(), one row of tiles at a time, right
+// before they're sent to the display.
+//
+// Drawing in a color that isn't in the palette yet adds it. When the palette is full, the closest color in it is used instead. Every
+// palette entry is found by the color it was added for, its key, but sent as the color it's mapped to, which starts out as the key.
+// Recolor() maps a key to another color, which changes every pixel drawn in that key at once, without drawing anything. Only the tiles
+// that have ever been drawn in that key are sent again.
+//
+// What changed is tracked in tiles like in TileCanvas, and tiles outside of the round display are never sent.
+
+#ifndef _INDEXED_CANVAS
+#define _INDEXED_CANVAS
+
+#include "TileCanvas.h"
+
+template <uint32_t BitsPerPixel>
+class IndexedCanvas : public DisplayCanvas
+{
+  public:
+    static_assert(BitsPerPixel == 4 || BitsPerPixel == 8, "Only 4 and 8 bits per pixel are supported");
+
+    static const uint32_t PaletteSize = 1 << BitsPerPixel;
+    static const uint32_t PixelsPerByte = 8 / BitsPerPixel;
+    static const uint32_t FlushBufferPixels = 240 * TileSize;
+
+    IndexedCanvas(Arduino_GFX* pOutput) : DisplayCanvas(pOutput->width(), pOutput->height()), m_pOutput(pOutput)
+    {
+    }
+
+    virtual ~IndexedCanvas()
+    {
+      free(m_pIndices);
+      heap_caps_free(m_pFlushBuffer);
+    }
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override
+    {
+      if (!m_pOutput->begin(speed))
+      {
+        return false;
+      }
+
+      if (m_pIndices == nullptr)
+      {
+        m_pIndices = (uint8_t*)malloc(BufferBytes());
+        m_pFlushBuffer = (uint16_t*)heap_caps_malloc(FlushBufferPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if (m_pIndices == nullptr || m_pFlushBuffer == nullptr)
+        {
+          // Free whichever one did get allocated, so the next begin() doesn't take a half allocated canvas for a complete one
+          DebugPrintln("IndexedCanvas: Failed to allocate the canvas");
+          free(m_pIndices);
+          heap_caps_free(m_pFlushBuffer);
+          m_pIndices = nullptr;
+          m_pFlushBuffer = nullptr;
+          return false;
+        }
+
+        // Everything starts out black, as palette entry 0
+        memset(m_pIndices, 0, BufferBytes());
+        m_paletteKeys[0] = BLACK;
+        m_paletteColors[0] = BLACK;
+        m_paletteSize = 1;
+        m_lastColor = BLACK;
+        m_lastIndex = 0;
+        MarkTiles(m_indexTiles[0], { 0, 0, WIDTH, HEIGHT });
+      }
+
+      // The display has just been reset, so there's no telling what it shows
+      MarkTiles(m_dirtyTiles, { 0, 0, WIDTH, HEIGHT });
+      return true;
+    }
+
+    void setRotation(uint8_t r) override
+    {
+      m_pOutput->setRotation(r);
+    }
+
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+    {
+      SetIndex(x, y, PaletteIndex(color));
+    }
+
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+      const uint8_t index = PaletteIndex(color);
+      for (int16_t j = y; j < y + h; j++)
+      {
+        for (int16_t i = x; i < x + w; i++)
+        {
+          SetIndex(i, j, index);
+        }
+      }
+    }
+
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override
+    {
+      for (int16_t j = max<int16_t>(y, 0); j < min<int16_t>(y + h, HEIGHT); j++)
+      {
+        for (int16_t i = max<int16_t>(x, 0); i < min<int16_t>(x + w, WIDTH); i++)
+        {
+          SetIndex(i, j, PaletteIndex(bitmap[(j - y) * w + (i - x)]));
+        }
+      }
+    }
+
+    // From now on, send the pixels drawn in key as color. The key is added to the palette if it's new
+    void Recolor(const uint16_t key, const uint16_t color)
+    {
+      const uint8_t index = PaletteIndex(key);
+      if (m_paletteColors[index] != color)
+      {
+        m_paletteColors[index] = color;
+        for (int16_t row = 0; row < TileRows; row++)
+        {
+          m_dirtyTiles.Rows[row] |= m_indexTiles[index].Rows[row];
+        }
+      }
+    }
+
+    void Flush() override
+    {
+      m_pOutput->startWrite();
+      const uint32_t numPixels = ForEachDirtyTileRun(m_dirtyTiles, [this](const int16_t x, const int16_t y, const int16_t w)
+      {
+        // Expand the indices to RGB565 while copying them
+        uint16_t* pPixel = m_pFlushBuffer;
+        for (int16_t j = y; j < y + TileSize; j++)
+        {
+          for (int16_t i = x; i < x + w; i++)
+          {
+            *pPixel++ = m_paletteColors[GetIndex(i, j)];
+          }
+        }
+        m_pOutput->draw16bitRGBBitmap(x, y, m_pFlushBuffer, w, TileSize);
+        m_stats.Rects++;
+      });
+      m_pOutput->endWrite();
+
+      if (numPixels > 0)
+      {
+        AddFlushStats(numPixels);
+      }
+    }
+
+    inline uint32_t BufferBytes() const { return uint32_t(WIDTH) * HEIGHT / PixelsPerByte; }
+
+    inline uint32_t NumPaletteColors() const { return m_paletteSize; }
+
+  private:
+    uint8_t GetIndex(const int16_t x, const int16_t y) const
+    {
+      const uint32_t pixel = uint32_t(y) * WIDTH + x;
+      const uint32_t shift = (PixelsPerByte - 1 - pixel % PixelsPerByte) * BitsPerPixel;
+      return (m_pIndices[pixel / PixelsPerByte] >> shift) & (PaletteSize - 1);
+    }
+
+    void SetIndex(const int16_t x, const int16_t y, const uint8_t index)
+    {
+      const uint32_t pixel = uint32_t(y) * WIDTH + x;
+      const uint32_t shift = (PixelsPerByte - 1 - pixel % PixelsPerByte) * BitsPerPixel;
+      uint8_t& byte = m_pIndices[pixel / PixelsPerByte];
+      const uint8_t newByte = (byte & ~((PaletteSize - 1) << shift)) | (index << shift);
+
+      if (newByte != byte)
+      {
+        byte = newByte;
+        const uint16_t tile = 1 << (x / TileSize);
+        m_dirtyTiles.Rows[y / TileSize] |= tile;
+        m_indexTiles[index].Rows[y / TileSize] |= tile;
+      }
+    }
+
+    // The palette entry of a key, which is added if it's new
+    uint8_t PaletteIndex(const uint16_t key)
+    {
+      // Mostly many pixels in a row are drawn in the same color
+      if (key == m_lastColor)
+      {
+        return m_lastIndex;
+      }
+
+      uint8_t index = 0;
+      while (index < m_paletteSize && m_paletteKeys[index] != key)
+      {
+        index++;
+      }
+
+      if (index == m_paletteSize)
+      {
+        if (m_paletteSize < PaletteSize)
+        {
+          m_paletteKeys[index] = key;
+          m_paletteColors[index] = key;
+          m_paletteSize++;
+        }
+        else
+        {
+          index = ClosestPaletteIndex(key);
+        }
+      }
+
+      m_lastColor = key;
+      m_lastIndex = index;
+      return index;
+    }
+
+    uint8_t ClosestPaletteIndex(const uint16_t key) const
+    {
+      uint8_t closest = 0;
+      int32_t closestDistance = INT32_MAX;
+      for (uint32_t i = 0; i < m_paletteSize; i++)
+      {
+        // Red and blue have 5 bits, green has 6
+        const int32_t dr = 2 * (int32_t(key >> 11) - (m_paletteKeys[i] >> 11));
+        const int32_t dg = int32_t((key >> 5) & 0x3F) - ((m_paletteKeys[i] >> 5) & 0x3F);
+        const int32_t db = 2 * (int32_t(key & 0x1F) - (m_paletteKeys[i] & 0x1F));
+        const int32_t distance = dr * dr + dg * dg + db * db;
+        if (distance < closestDistance)
+        {
+          closest = i;
+          closestDistance = distance;
+        }
+      }
+      return closest;
+    }
+
+    Arduino_GFX* m_pOutput;
+    uint8_t* m_pIndices = nullptr;
+    uint16_t* m_pFlushBuffer = nullptr;
+    uint16_t m_paletteKeys[PaletteSize];
+    uint16_t m_paletteColors[PaletteSize];
+    uint32_t m_paletteSize = 0;
+    uint16_t m_lastColor = BLACK;
+    uint8_t m_lastIndex = 0;
+    TileMask m_dirtyTiles = {};
+    TileMask m_indexTiles[PaletteSize] = {};    // The tiles that have ever been drawn in each palette entry
+};
+
+#endif  // _INDEXED_CANVAS
@@ -1,70 +1,55 @@
-// If we want to display the text on a projective film as a holographic effect on the windshield, then we need to mirror the text
+// If we want to display the text on a projective film as a holographic effect on the windshield, then we need to mirror the text. The
+// fonts are mirrored at compile time, so the mirrored glyphs live in flash and take no RAM
 
 #ifndef _MIRROR_FONT
 #define _MIRROR_FONT
 
-uint8_t tempFontBuffer[1024];
-
-// Get the Nth bit in a byte
-uint8_t GetNthBit(uint8_t byte, uint8_t n)
+// A copy of a font's glyph bitmaps that's computed at compile time, so it can live in flash like the font itself
+template <size_t NumBytes>
+struct FontBitmap
 {
-  return (byte >> n) & 1;
-}
-
-// Set the Nth bit in a byte
-uint8_t SetNthBit(uint8_t byte, uint8_t n, uint8_t input)
+  uint8_t Bytes[NumBytes];
+};
+
+// Compile time version of MirrorText(), for the glyphs of the characters in pChars. Produces the same bytes as calling MirrorText() on
+// a writable copy of the bitmaps for each of those characters, see "--check-gear-font" in the host build
+template <size_t NumBytes, size_t NumGlyphs>
+constexpr FontBitmap<NumBytes> MirrorFontBitmap(const uint8_t (&bitmap)[NumBytes], const GFXglyph (&glyphs)[NumGlyphs], const uint16_t first,
+                                                const char* pChars)
 {
-  if (input >= 1)
-  {
-      return byte | (1 << n);
-  }
-  else
+  FontBitmap<NumBytes> mirrored {};
+  for (size_t i = 0; i < NumBytes; i++)
   {
-    return byte & ~(1 << n);
+    mirrored.Bytes[i] = bitmap[i];
   }
-}
-
-// Get a pixel in 1-bit font memory. Pixels in the font is 1-bit encoded, i.e. one pixel is one bit. The value returned is a byte, but only represents 0 or 1
-uint8_t GetPixel(const uint16_t x, const uint16_t y, uint8_t* pData, const uint8_t width, const uint16_t numPixels, const uint16_t numBytes)
-{
-  uint16_t pixelPosition = (y * width) + x;
-  uint16_t pixelByteOffset = pixelPosition / 8;
-  uint8_t pixelBitOffset = pixelPosition % 8;
-  uint8_t pixelByte = pData[pixelByteOffset];                       // The byte that contains the pixel at (x,y)
-  uint8_t pixelValue = GetNthBit(pixelByte, 7 - pixelBitOffset);    // "7 -" is needed because the most significant bit represents the pixel on the right, not the left
-  return pixelValue;
-}
 
-// Set pixel in 1-bit font memory. Pixels in the font is 1-bit encoded, i.e. one pixel is one bit. The input value is a byte, but only represents 0 or 1
-void SetPixel(const uint16_t x, const uint16_t y, const uint8_t newPixelValue, uint8_t* pData, const uint8_t width, const uint16_t numPixels, const uint16_t numBytes)
-{
-  uint16_t pixelPosition = (y * width) + x;
-  uint16_t pixelByteOffset = pixelPosition / 8;
-  uint8_t pixelBitOffset = pixelPosition % 8;
-  uint8_t pixelByte = pData[pixelByteOffset];   // The byte that contains the pixel at (x,y)
-  pData[pixelByteOffset] = SetNthBit(pixelByte, 7 - pixelBitOffset, newPixelValue);
-}
-
-// Mirror the font by mirroring all pixels horizontally
-// There's opportunity to optimize this function by processing 8 pixels at a time, but it's already fast enough, ~1ms per character for a 54pt font
-void MirrorText(uint8_t* pData, const uint16_t offset, const uint8_t width, const uint8_t height)
-{
-  // Pixels in the font is 1-bit encoded, i.e. one pixel is one bit
-  const uint16_t numPixels = width * height;
-  const uint16_t numBytes = (numPixels / 8) + 1;
+  for (; *pChars != 0; pChars++)
+  {
+    const GFXglyph& glyph = glyphs[uint8_t(*pChars) - first];
+    const uint32_t numPixels = uint32_t(glyph.width) * glyph.height;
+    uint8_t* pData = mirrored.Bytes + glyph.bitmapOffset;
 
-  // Copy the original data into a temp buffer
-  memcpy(tempFontBuffer, pData + offset, numBytes);
-  memset(pData + offset, 0, numBytes);
+    for (uint32_t i = 0; i < (numPixels + 7) / 8; i++)
+    {
+      pData[i] = 0;
+    }
 
-  for (int j = 0; j < height; j++)
-  {
-    for (int i = 0; i < width; i++)
+    // Always read from the original bitmap, so mirroring a character twice doesn't undo it
+    for (uint32_t y = 0; y < glyph.height; y++)
     {
-      int8_t pixelValue = GetPixel(i, j, tempFontBuffer, width, numPixels, numBytes);
-      SetPixel(width - 1 - i, j, pixelValue, pData + offset, width, numPixels, numBytes);
+      for (uint32_t x = 0; x < glyph.width; x++)
+      {
+        const uint32_t from = y * glyph.width + x;
+        const uint32_t to = y * glyph.width + (glyph.width - 1 - x);
+        if (bitmap[glyph.bitmapOffset + from / 8] & (0x80 >> (from % 8)))
+        {
+          pData[to / 8] |= 0x80 >> (to % 8);
+        }
+      }
     }
   }
+
+  return mirrored;
 }
 
 #endif  // _MIRROR_FONT
\ No newline at end of file
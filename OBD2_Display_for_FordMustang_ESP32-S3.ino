@@ -28,6 +28,30 @@
 // If we want to display the text on a projective film as a holographic effect on the windshield, then we need to mirror the text
 #define MIRROR_TEXT_FOR_HOLOGRAPHIC_REFLECTION 1
 
+// Send pixels to the display using DMA, in larger transfers. The CPU still waits for every transfer, which is why DisplayTransfer.h sends
+// them from the other core
+//#define DISPLAY_SPI_DMA 1
+
+// Draw into an offscreen copy of the screen (in PSRAM), and only send the parts that changed to the display once per frame (see OffscreenCanvas.h)
+//#define DISPLAY_OFFSCREEN_CANVAS 1
+
+// The same, but keep track of what changed in 16x16 tiles, and never send the tiles outside of the round display (see TileCanvas.h)
+//#define DISPLAY_TILE_CANVAS 1
+
+// The same, but with a 4 bit palette index per pixel instead of a 16 bit color, so the canvas fits in internal RAM, and the gear flashes
+// red by changing its palette entry instead of being drawn again (see IndexedCanvas.h)
+//#define DISPLAY_INDEXED_CANVAS 1
+
+// Whenever anything changes, render the whole screen in bands of rows, and send each band in one go (see ScanlineRenderer.h). Best
+// combined with DISPLAY_SPI_DMA
+//#define DISPLAY_SCANLINE_RENDERER 1
+
+// Show the engine RPM as a number below the gear
+//#define DISPLAY_RPM_READOUT 1
+
+// Show the engine RPM of the last 10 seconds as a strip above the gear
+//#define DISPLAY_RPM_HISTORY 1
+
 #include "Shared.h"
 #include "AsyncTimer.h"
 #include "CollectCarData.h"
@@ -65,4 +89,8 @@ void loop()
 {
   CollectCarData();
   CheckIfCarIsStillOn();
+
+#ifdef DEBUG
+  PrintFrameTiming();
+#endif
 }
@@ -0,0 +1,242 @@
+// An offscreen copy of the display that everything is drawn into, see DISPLAY_OFFSCREEN_CANVAS. Nothing is sent to the display until
+// Flush(), which sends the parts of the canvas that changed since the last flush. A pixel that's drawn more than once in a frame, e.g.
+// erased and then drawn in another color, is only sent once, and drawing a pixel in the color it already has doesn't send it at all.
+//
+// The changed parts are kept as a short list of rectangles. A rectangle that touches or overlaps another one is merged with it, and when
+// the list is full, a new rectangle is merged with the one that grows the least. Flush() sends every rectangle through a small buffer in
+// internal RAM, since pixels have to be contiguous to be sent in one go.
+//
+// The canvas lives in PSRAM when there is PSRAM. The display is rotated in hardware, so the canvas always has the display's orientation.
+
+#ifndef _OFFSCREEN_CANVAS
+#define _OFFSCREEN_CANVAS
+
+struct CanvasRect
+{
+  int16_t X0;
+  int16_t Y0;
+  int16_t X1;   // Exclusive
+  int16_t Y1;   // Exclusive
+
+  int32_t Area() const { return int32_t(X1 - X0) * (Y1 - Y0); }
+
+  bool Touches(const CanvasRect& other) const { return X0 <= other.X1 && other.X0 <= X1 && Y0 <= other.Y1 && other.Y0 <= Y1; }
+
+  CanvasRect Union(const CanvasRect& other) const
+  {
+    return { min(X0, other.X0), min(Y0, other.Y0), max(X1, other.X1), max(Y1, other.Y1) };
+  }
+};
+
+struct OffscreenCanvasStats
+{
+  uint32_t Flushes;
+  uint32_t Rects;           // Rectangles sent to the display
+  uint64_t Pixels;          // Pixels sent to the display
+  uint32_t MaxFlushPixels;  // Most pixels sent by one flush
+};
+
+// Something that's drawn into like the display, but only sends what was drawn to the display in Flush()
+class DisplayCanvas : public Arduino_GFX
+{
+  public:
+    DisplayCanvas(const int16_t w, const int16_t h) : Arduino_GFX(w, h)
+    {
+    }
+
+    // Send what changed since the last flush to the display
+    virtual void Flush() = 0;
+
+    inline const OffscreenCanvasStats& Stats() const { return m_stats; }
+
+  protected:
+    void AddFlushStats(const uint32_t numPixels)
+    {
+      m_stats.Flushes++;
+      m_stats.Pixels += numPixels;
+      m_stats.MaxFlushPixels = max(m_stats.MaxFlushPixels, numPixels);
+    }
+
+    OffscreenCanvasStats m_stats = { 0 };
+};
+
+class OffscreenCanvas : public DisplayCanvas
+{
+  public:
+    static const uint32_t MaxDirtyRects = 8;
+    static const uint32_t FlushBufferPixels = 240 * 16;
+
+    OffscreenCanvas(Arduino_GFX* pOutput) : DisplayCanvas(pOutput->width(), pOutput->height()), m_pOutput(pOutput)
+    {
+    }
+
+    virtual ~OffscreenCanvas()
+    {
+      free(m_pPixels);
+      heap_caps_free(m_pFlushBuffer);
+    }
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override
+    {
+      if (!m_pOutput->begin(speed))
+      {
+        return false;
+      }
+
+      if (m_pPixels == nullptr)
+      {
+        const size_t numBytes = size_t(WIDTH) * HEIGHT * sizeof(uint16_t);
+        m_pPixels = (uint16_t*)(psramFound() ? ps_malloc(numBytes) : malloc(numBytes));
+        m_pFlushBuffer = (uint16_t*)heap_caps_malloc(FlushBufferPixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+        if (m_pPixels == nullptr || m_pFlushBuffer == nullptr)
+        {
+          // Free whichever one did get allocated, so the next begin() doesn't take a half allocated canvas for a complete one
+          DebugPrintln("OffscreenCanvas: Failed to allocate the canvas");
+          free(m_pPixels);
+          heap_caps_free(m_pFlushBuffer);
+          m_pPixels = nullptr;
+          m_pFlushBuffer = nullptr;
+          return false;
+        }
+        memset(m_pPixels, 0, numBytes);
+      }
+
+      // The display has just been reset, so there's no telling what it shows
+      m_numDirtyRects = 0;
+      MarkDirty({ 0, 0, WIDTH, HEIGHT });
+      return true;
+    }
+
+    void setRotation(uint8_t r) override
+    {
+      m_pOutput->setRotation(r);
+    }
+
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+    {
+      uint16_t& pixel = m_pPixels[y * WIDTH + x];
+      if (pixel != color)
+      {
+        pixel = color;
+        MarkDirty({ x, y, int16_t(x + 1), int16_t(y + 1) });
+      }
+    }
+
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+      // Only the part that actually changes color is dirty
+      CanvasRect changed = { int16_t(x + w), int16_t(y + h), x, y };
+
+      for (int16_t j = y; j < y + h; j++)
+      {
+        uint16_t* pRow = m_pPixels + j * WIDTH;
+        for (int16_t i = x; i < x + w; i++)
+        {
+          if (pRow[i] != color)
+          {
+            pRow[i] = color;
+            changed = changed.Union({ i, j, int16_t(i + 1), int16_t(j + 1) });
+          }
+        }
+      }
+
+      if (changed.X0 < changed.X1)
+      {
+        MarkDirty(changed);
+      }
+    }
+
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override
+    {
+      for (int16_t j = max<int16_t>(y, 0); j < min<int16_t>(y + h, HEIGHT); j++)
+      {
+        for (int16_t i = max<int16_t>(x, 0); i < min<int16_t>(x + w, WIDTH); i++)
+        {
+          writePixelPreclipped(i, j, bitmap[(j - y) * w + (i - x)]);
+        }
+      }
+    }
+
+    void Flush() override
+    {
+      if (m_numDirtyRects == 0)
+      {
+        return;
+      }
+
+      uint32_t numPixels = 0;
+      m_pOutput->startWrite();
+      for (uint32_t r = 0; r < m_numDirtyRects; r++)
+      {
+        const CanvasRect& rect = m_dirtyRects[r];
+        const int16_t w = rect.X1 - rect.X0;
+        const int16_t bandRows = max<int16_t>(FlushBufferPixels / w, 1);
+
+        for (int16_t y = rect.Y0; y < rect.Y1; y += bandRows)
+        {
+          const int16_t h = min<int16_t>(bandRows, rect.Y1 - y);
+          for (int16_t j = 0; j < h; j++)
+          {
+            memcpy(m_pFlushBuffer + j * w, m_pPixels + (y + j) * WIDTH + rect.X0, w * sizeof(uint16_t));
+          }
+          m_pOutput->draw16bitRGBBitmap(rect.X0, y, m_pFlushBuffer, w, h);
+        }
+
+        m_stats.Rects++;
+        numPixels += rect.Area();
+      }
+      m_pOutput->endWrite();
+
+      AddFlushStats(numPixels);
+      m_numDirtyRects = 0;
+    }
+
+  protected:
+    virtual void MarkDirty(CanvasRect rect)
+    {
+      // Merging can make the rectangle touch others it didn't touch before, so keep going until it doesn't touch any
+      for (uint32_t i = 0; i < m_numDirtyRects;)
+      {
+        if (rect.Touches(m_dirtyRects[i]))
+        {
+          rect = rect.Union(m_dirtyRects[i]);
+          m_dirtyRects[i] = m_dirtyRects[--m_numDirtyRects];
+          i = 0;
+        }
+        else
+        {
+          i++;
+        }
+      }
+
+      if (m_numDirtyRects < MaxDirtyRects)
+      {
+        m_dirtyRects[m_numDirtyRects++] = rect;
+        return;
+      }
+
+      uint32_t best = 0;
+      for (uint32_t i = 1; i < MaxDirtyRects; i++)
+      {
+        if (rect.Union(m_dirtyRects[i]).Area() - m_dirtyRects[i].Area() < rect.Union(m_dirtyRects[best]).Area() - m_dirtyRects[best].Area())
+        {
+          best = i;
+        }
+      }
+
+      // The merged rectangle can touch others now, so it's added again
+      const CanvasRect merged = rect.Union(m_dirtyRects[best]);
+      m_dirtyRects[best] = m_dirtyRects[--m_numDirtyRects];
+      MarkDirty(merged);
+    }
+
+    Arduino_GFX* m_pOutput;
+    uint16_t* m_pPixels = nullptr;
+    uint16_t* m_pFlushBuffer = nullptr;
+
+  private:
+    CanvasRect m_dirtyRects[MaxDirtyRects];
+    uint32_t m_numDirtyRects = 0;
+};
+
+#endif  // _OFFSCREEN_CANVAS
@@ -0,0 +1,49 @@
+// Lock-free ring of the last Capacity samples of a value, to pass a history from the core that collects the car data to the display core.
+// There is a single writer, which never waits, and a single reader. Every sample has a number, counting up from 0, and sample n is stored
+// in slot n % Capacity, so once Capacity newer samples have been written, it's overwritten. The writer stores the sample before it
+// publishes the new count, so the reader never sees a sample that isn't completely written. A reader that falls behind by more than
+// Capacity samples just skips the ones that were overwritten, see Read().
+//
+// The samples are stored as 32-bit atomics, so reading one is well defined even when it races with a write.
+
+#ifndef _SAMPLE_RING
+#define _SAMPLE_RING
+
+#include <stdint.h>
+#include <atomic>
+
+template <uint32_t Capacity>
+class SampleRing
+{
+  public:
+    // Must only be called from one thread
+    void Write(const int32_t value)
+    {
+      const uint32_t count = m_count.load(std::memory_order_relaxed);
+
+      // A reader that sees the new sample in the slot also sees the count that makes it reject the sample that was there
+      std::atomic_thread_fence(std::memory_order_release);
+      m_samples[count % Capacity].store(value, std::memory_order_relaxed);
+      m_count.store(count + 1, std::memory_order_release);
+    }
+
+    // The number of samples that were ever written, which is the number of the next sample
+    inline uint32_t Count() const { return m_count.load(std::memory_order_acquire); }
+
+    // Read sample n, which has to be less than Count(). Returns false if it may have been overwritten, so only the last Capacity - 1
+    // samples can be read for sure
+    bool Read(const uint32_t n, int32_t& value) const
+    {
+      value = m_samples[n % Capacity].load(std::memory_order_relaxed);
+
+      // The writer may have started to overwrite the slot while we were reading it
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return m_count.load(std::memory_order_relaxed) - n < Capacity;
+    }
+
+  private:
+    std::atomic<uint32_t> m_count { 0 };
+    std::atomic<int32_t> m_samples[Capacity] = {};
+};
+
+#endif  // _SAMPLE_RING
@@ -0,0 +1,106 @@
+// Renders the whole screen from top to bottom in bands of BandRows rows, see DISPLAY_SCANLINE_RENDERER. Every band is rendered into a
+// small buffer, with every widget setting its own pixels, and sent to the display as a single block of pixels through the double-buffered
+// DisplayTransferPipeline, so the next band is rendered while the other core sends the previous one. Drawing the whole screen costs one
+// pass of contiguous pixels, and only takes the two band buffers, instead of a full framebuffer.
+//
+// The display only shows a circle, so every band only covers the columns of the circle in the widest row of the band. The circle is
+// CircleMargin pixels larger than the display, since the shift indicator ring from ArcSpans.h reaches just beyond its edge, and the
+// screen has to end up the same as when the widgets draw to the display themselves.
+//
+// Usage:
+//    renderer.Begin(gfx, xPortGetCoreID());     // The bands are sent from the other core
+//    renderer.RenderFrame(RenderScreenRows);   // RenderScreenRows(pPixels, band) has every widget render into the band
+
+#ifndef _SCANLINE_RENDERER
+#define _SCANLINE_RENDERER
+
+#include "DisplayTransfer.h"
+
+struct ScanlineRendererStats
+{
+  uint32_t Frames;
+  uint64_t Pixels;              // Pixels sent to the display
+  uint64_t RenderMicros;        // Time spent rendering bands, not waiting for buffers
+};
+
+// Set the pixels of everything on the screen that's inside the band. The pixels of the band are already black
+typedef void (*RenderBandFunction)(uint16_t* pPixels, const BandRect& band);
+
+class ScanlineRenderer
+{
+  public:
+    static constexpr int16_t BandRows = 16;
+    static constexpr int16_t MaxBands = 32;
+    static constexpr int16_t CircleMargin = 2;
+
+    bool Begin(Arduino_GFX* pGfx, const BaseType_t renderCoreID)
+    {
+      const int16_t width = pGfx->width();
+      const int16_t height = pGfx->height();
+      const int32_t diameter = min(width, height);
+      m_numBands = min<int16_t>((height + BandRows - 1) / BandRows, MaxBands);
+      memset(&m_stats, 0, sizeof(m_stats));
+
+      for (int16_t b = 0; b < m_numBands; b++)
+      {
+        const int16_t y = b * BandRows;
+        const int16_t rows = min<int16_t>(BandRows, height - y);
+
+        // The row nearest to the center is the widest. A pixel is inside the circle if its center is, so the distances are doubled
+        const int32_t centerRow = min<int32_t>(max<int32_t>(diameter / 2, y), y + rows - 1);
+        const int32_t dy = 2 * centerRow + 1 - diameter;
+        const int32_t radius2 = (diameter + 2 * CircleMargin) * (diameter + 2 * CircleMargin);
+        int16_t left = 0;
+        while (left < diameter / 2 && (2 * left + 1 - diameter) * (2 * left + 1 - diameter) + dy * dy >= radius2)
+        {
+          left++;
+        }
+
+        m_bands[b] = { left, y, int16_t(max(width - 2 * left, 0)), rows };
+      }
+
+      return m_pipeline.Begin(pGfx, uint32_t(width) * BandRows, renderCoreID);
+    }
+
+    void End()
+    {
+      m_pipeline.End();
+    }
+
+    // Render and send every band, and wait until the last one has been sent
+    void RenderFrame(RenderBandFunction renderBand)
+    {
+      for (int16_t b = 0; b < m_numBands; b++)
+      {
+        const BandRect& band = m_bands[b];
+        if (band.W == 0)
+        {
+          continue;
+        }
+
+        uint16_t* pPixels = m_pipeline.AcquireBuffer();
+        const unsigned long startMicros = micros();
+
+        const uint32_t numPixels = uint32_t(band.W) * band.H;
+        memset(pPixels, 0, numPixels * sizeof(uint16_t));
+        renderBand(pPixels, band);
+
+        m_stats.RenderMicros += micros() - startMicros;
+        m_stats.Pixels += numPixels;
+        m_pipeline.Submit(pPixels, band.X, band.Y, band.W, band.H);
+      }
+
+      m_pipeline.Flush();
+      m_stats.Frames++;
+    }
+
+    inline const ScanlineRendererStats& Stats() const { return m_stats; }
+
+  private:
+    DisplayTransferPipeline m_pipeline;
+    BandRect m_bands[MaxBands];
+    int16_t m_numBands = 0;
+    ScanlineRendererStats m_stats = { 0 };
+};
+
+#endif  // _SCANLINE_RENDERER
@@ -0,0 +1,92 @@
+// Lock-free way to share a small struct between the two ESP32-S3 cores. There is a single writer, which never waits, and any number of
+// readers, which always get a consistent copy. A sequence number is incremented before and after the data is written, so it's odd while a
+// write is in progress. A reader copies the data and compares the sequence number from before and after the copy, and simply copies again
+// if the data was written in the meantime. Since the writer only copies a few words, readers hardly ever have to retry.
+//
+// The data is stored as 32-bit atomics, so the copy is well defined even when it races with a write.
+
+#ifndef _SEQ_LOCK
+#define _SEQ_LOCK
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+template <typename T>
+class SeqLock
+{
+  static_assert(sizeof(T) % sizeof(uint32_t) == 0, "SeqLock data must be a multiple of 32 bits");
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock data must be trivially copyable");
+
+  public:
+    SeqLock()
+    {
+      const T value {};
+      Write(value);
+    }
+
+    // Must only be called from one thread
+    void Write(const T& value)
+    {
+      const uint8_t* pBytes = (const uint8_t*)&value;
+
+      const uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+      m_sequence.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      // Word by word, so large structs don't need a copy on the stack
+      for (size_t i = 0; i < NumWords; i++)
+      {
+        uint32_t word;
+        memcpy(&word, pBytes + i * sizeof(uint32_t), sizeof(uint32_t));
+        m_words[i].store(word, std::memory_order_relaxed);
+      }
+
+      m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Can be called from any thread. Returns the number of times the copy had to be retried because of a concurrent write
+    uint32_t Read(T& value) const
+    {
+      uint8_t* pBytes = (uint8_t*)&value;
+      uint32_t before;
+      uint32_t after;
+      uint32_t retries = 0;
+
+      // Straight into value, which is only ours, so large structs don't need a copy on the stack. A torn copy is simply overwritten
+      while (true)
+      {
+        before = m_sequence.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < NumWords; i++)
+        {
+          const uint32_t word = m_words[i].load(std::memory_order_relaxed);
+          memcpy(pBytes + i * sizeof(uint32_t), &word, sizeof(uint32_t));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = m_sequence.load(std::memory_order_relaxed);
+
+        if ((before & 1) == 0 && before == after)
+        {
+          break;
+        }
+
+        retries++;
+      }
+
+      return retries;
+    }
+
+    // Changes every time the data is written
+    inline uint32_t Sequence() const { return m_sequence.load(std::memory_order_acquire); }
+
+  private:
+    static constexpr size_t NumWords = sizeof(T) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> m_sequence { 0 };
+    std::atomic<uint32_t> m_words[NumWords];
+};
+
+#endif  // _SEQ_LOCK
@@ -1,6 +1,9 @@
 #ifndef _SHARED
 #define _SHARED
 
+#include "SeqLock.h"
+#include "SampleRing.h"
+
 #ifdef DEBUG
 #define DebugPrintf(...) Serial.printf(__VA_ARGS__)
 #define DebugPrintln(...) Serial.println(__VA_ARGS__)
@@ -29,9 +32,17 @@ struct CarData
   int32_t GearboxMode;
 };
 
-// This data is shared between two ESP32-S3 cores
+// Car data is collected on ESP32-S3 core 1 into g_CurrentCarData, then published to g_SharedCarData to be used on core 0
 CarData g_CurrentCarData { 0 };
-SemaphoreHandle_t g_SemaphoreCarData = nullptr;
+SeqLock<CarData> g_SharedCarData;
 TaskHandle_t g_TaskDisplayInfo = nullptr;
 
+// With DISPLAY_RPM_HISTORY, the engine RPM is also sampled every RPMHistorySampleMillis on core 1 into g_RPMHistory, for the RPM history
+// strip on core 0. The strip is 80 columns wide and keeps one of them blank, so it shows the last 79 samples, just under 10 seconds
+const unsigned long RPMHistorySampleMillis = 125;
+const uint32_t RPMHistorySamples = 128;
+#ifdef DISPLAY_RPM_HISTORY
+SampleRing<RPMHistorySamples> g_RPMHistory;
+#endif
+
 #endif  // _SHARED
\ No newline at end of file
@@ -0,0 +1,152 @@
+// An offscreen canvas that keeps track of what changed in tiles of TileSize x TileSize pixels instead of rectangles, see
+// DISPLAY_TILE_CANVAS. Drawing marks the tiles it changes in a bitmap with one bit per tile, and Flush() sends the dirty tiles, with the
+// dirty tiles next to each other in a row of tiles sent as one window.
+//
+// The GC9A01 only shows a circle, so tiles that are completely outside of it are never sent. That also bounds what a frame can cost:
+// a flush never sends more than NumVisibleTiles tiles, however much was drawn.
+//
+// The tiles are kept in the buffers of OffscreenCanvas, so begin() fails the same way when they can't be allocated, and BeginDisplay()
+// then draws straight to the panel instead.
+
+#ifndef _TILE_CANVAS
+#define _TILE_CANVAS
+
+#include "OffscreenCanvas.h"
+
+constexpr int16_t TileSize = 16;
+constexpr int16_t TileColumns = 240 / TileSize;
+constexpr int16_t TileRows = 240 / TileSize;
+
+// One bit per tile, bit i of Rows[j] is tile i of row j
+struct TileMask
+{
+  uint16_t Rows[TileRows];
+};
+
+static_assert(TileColumns <= 16, "A row of tiles has to fit in TileMask::Rows");
+
+// True if any pixel of the tile is inside the circle the display shows. Pixel x,y is inside if its center is, so the distances are
+// doubled to keep them integers
+constexpr bool IsTileVisible(const int16_t column, const int16_t row)
+{
+  const int32_t diameter = TileColumns * TileSize;
+  const int32_t left = 2 * column * TileSize + 1;
+  const int32_t top = 2 * row * TileSize + 1;
+  const int32_t right = left + 2 * (TileSize - 1);
+  const int32_t bottom = top + 2 * (TileSize - 1);
+
+  // The pixel of the tile nearest to the center
+  const int32_t x = (diameter < left) ? left : (diameter > right) ? right : diameter;
+  const int32_t y = (diameter < top) ? top : (diameter > bottom) ? bottom : diameter;
+  return (x - diameter) * (x - diameter) + (y - diameter) * (y - diameter) < diameter * diameter;
+}
+
+constexpr TileMask VisibleTileMask()
+{
+  TileMask mask {};
+  for (int16_t row = 0; row < TileRows; row++)
+  {
+    for (int16_t column = 0; column < TileColumns; column++)
+    {
+      mask.Rows[row] |= IsTileVisible(column, row) ? (1 << column) : 0;
+    }
+  }
+  return mask;
+}
+
+constexpr TileMask VisibleTiles = VisibleTileMask();
+
+constexpr uint32_t CountVisibleTiles()
+{
+  uint32_t numTiles = 0;
+  for (int16_t row = 0; row < TileRows; row++)
+  {
+    for (int16_t column = 0; column < TileColumns; column++)
+    {
+      numTiles += (VisibleTiles.Rows[row] >> column) & 1;
+    }
+  }
+  return numTiles;
+}
+
+constexpr uint32_t NumVisibleTiles = CountVisibleTiles();
+
+// Mark every tile the rectangle touches
+inline void MarkTiles(TileMask& tiles, const CanvasRect& rect)
+{
+  const uint16_t columns = ((1 << ((rect.X1 + TileSize - 1) / TileSize)) - 1) & ~((1 << (rect.X0 / TileSize)) - 1);
+  for (int16_t row = rect.Y0 / TileSize; row < (rect.Y1 + TileSize - 1) / TileSize; row++)
+  {
+    tiles.Rows[row] |= columns;
+  }
+}
+
+// Call sendRun(x, y, w) for every run of dirty tiles next to each other in a row of tiles that are visible, where the run is w pixels wide
+// and TileSize rows high, and clear the dirty tiles. Returns the number of pixels in the runs
+template <typename SendRun>
+uint32_t ForEachDirtyTileRun(TileMask& dirtyTiles, SendRun sendRun)
+{
+  uint32_t numPixels = 0;
+
+  for (int16_t row = 0; row < TileRows; row++)
+  {
+    uint16_t dirty = dirtyTiles.Rows[row] & VisibleTiles.Rows[row];
+    dirtyTiles.Rows[row] = 0;
+
+    while (dirty != 0)
+    {
+      // The run of dirty tiles that starts at the lowest dirty one
+      const int16_t first = __builtin_ctz(dirty);
+      const int16_t last = first + __builtin_ctz(~(dirty >> first));
+      dirty &= ~(((1 << last) - 1) & ~((1 << first) - 1));
+
+      const int16_t w = (last - first) * TileSize;
+      sendRun(int16_t(first * TileSize), int16_t(row * TileSize), w);
+      numPixels += w * TileSize;
+    }
+  }
+
+  return numPixels;
+}
+
+class TileCanvas : public OffscreenCanvas
+{
+  public:
+    static_assert(TileSize * 240 <= FlushBufferPixels, "A row of tiles has to fit in the flush buffer");
+
+    TileCanvas(Arduino_GFX* pOutput) : OffscreenCanvas(pOutput)
+    {
+    }
+
+    // Send the dirty tiles that are visible to the display
+    void Flush() override
+    {
+      m_pOutput->startWrite();
+      const uint32_t numPixels = ForEachDirtyTileRun(m_dirtyTiles, [this](const int16_t x, const int16_t y, const int16_t w)
+      {
+        for (int16_t j = 0; j < TileSize; j++)
+        {
+          memcpy(m_pFlushBuffer + j * w, m_pPixels + (y + j) * WIDTH + x, w * sizeof(uint16_t));
+        }
+        m_pOutput->draw16bitRGBBitmap(x, y, m_pFlushBuffer, w, TileSize);
+        m_stats.Rects++;
+      });
+      m_pOutput->endWrite();
+
+      if (numPixels > 0)
+      {
+        AddFlushStats(numPixels);
+      }
+    }
+
+  protected:
+    void MarkDirty(CanvasRect rect) override
+    {
+      MarkTiles(m_dirtyTiles, rect);
+    }
+
+  private:
+    TileMask m_dirtyTiles = {};
+};
+
+#endif  // _TILE_CANVAS
@@ -0,0 +1,609 @@
+// A retained-mode widget layer. Every widget is bound to signals, values it computes from the car data, and remembers what it last drew,
+// so Update() doesn't draw anything unless a value changed, and then only what changed. The screen is a list of widgets, see ScreenLayout
+// in DisplayInfo.h, so a widget only adds to the cost of the frames in which its value changes.
+//
+// Widgets draw through the Arduino_GFX they're given, and never rely on its font or text settings. They can also render themselves into
+// bands of rows in memory instead, see ScanlineRenderer.h.
+
+#ifndef _WIDGETS
+#define _WIDGETS
+
+#include "ArcSpans.h"
+#include "GlyphTransition.h"
+#include "SampleRing.h"
+
+// A value from the car data that a widget shows, e.g. the engine RPM, or the color to show it in
+typedef int32_t (*CarDataSignal)(const CarData& carData);
+
+// Rows Y up to Y + H of the screen, from X up to X + W, rendered into a buffer of W * H pixels
+struct BandRect
+{
+  int16_t X;
+  int16_t Y;
+  int16_t W;
+  int16_t H;
+};
+
+// Set the pixels of character c of the font that are inside the band, like gfx->printf() would with the cursor at cursorX,cursorY
+inline void RenderGlyphRows(uint16_t* pPixels, const BandRect& band, const GFXfont& font, const char c, const int16_t cursorX,
+                            const int16_t cursorY, const uint8_t textSize, const uint16_t color)
+{
+  const GFXglyph& glyph = font.glyph[uint8_t(c) - font.first];
+
+  for (int16_t j = 0; j < band.H; j++)
+  {
+    // The row of the glyph, in font pixels relative to the cursor, rounded down
+    const int16_t dy = band.Y + j - cursorY;
+    const int16_t y = (dy >= 0) ? dy / textSize : -((-dy + textSize - 1) / textSize);
+    if (y < glyph.yOffset || y >= glyph.yOffset + glyph.height)
+    {
+      continue;
+    }
+
+    uint16_t* pRow = pPixels + j * band.W - band.X;
+    for (int16_t x = glyph.xOffset; x < glyph.xOffset + glyph.width; x++)
+    {
+      if (IsGlyphPixelSet(font, glyph, x, y))
+      {
+        const int16_t left = max<int16_t>(cursorX + x * textSize, band.X);
+        const int16_t right = min<int16_t>(cursorX + (x + 1) * textSize, band.X + band.W);
+        for (int16_t i = left; i < right; i++)
+        {
+          pRow[i] = color;
+        }
+      }
+    }
+  }
+}
+
+class Widget
+{
+  public:
+    virtual ~Widget() {}
+
+    // Forget what's on the display, because the screen was cleared, so the next Update() draws the whole widget
+    virtual void Invalidate() = 0;
+
+    // Draw what changed since the last update
+    virtual void Update(Arduino_GFX* pGfx, const CarData& carData) = 0;
+
+    // Take the values the next RenderRows() calls render from the car data. Returns true if they're not what the widget shows now
+    virtual bool BeginRender(const CarData& carData) = 0;
+
+    // Set the pixels of the widget that are inside the band. The pixels of the band are already black
+    virtual void RenderRows(uint16_t* pPixels, const BandRect& band) const = 0;
+};
+
+// A single character of a GFXfont, e.g. the gear, which is replaced by writing only the pixels that change
+class GearTextWidget : public Widget
+{
+  public:
+    GearTextWidget(const GFXfont* pFont, const int16_t cursorX, const int16_t cursorY, const uint8_t textSize, CarDataSignal text, CarDataSignal color)
+      : m_pFont(pFont), m_cursorX(cursorX), m_cursorY(cursorY), m_textSize(textSize), m_text(text), m_color(color)
+    {
+    }
+
+    void Invalidate() override
+    {
+      m_shownText = NotShown;
+    }
+
+    void Update(Arduino_GFX* pGfx, const CarData& carData) override
+    {
+      const char text = char(m_text(carData));
+      const uint16_t color = uint16_t(m_color(carData));
+      if (text != m_shownText || color != m_shownColor)
+      {
+        Draw(pGfx, text, color);
+      }
+    }
+
+    bool BeginRender(const CarData& carData) override
+    {
+      const char text = char(m_text(carData));
+      const uint16_t color = uint16_t(m_color(carData));
+      const bool bChanged = (text != m_shownText || color != m_shownColor);
+      m_shownText = text;
+      m_shownColor = color;
+      return bChanged;
+    }
+
+    void RenderRows(uint16_t* pPixels, const BandRect& band) const override
+    {
+      RenderGlyphRows(pPixels, band, *m_pFont, m_shownText, m_cursorX, m_cursorY, m_textSize, m_shownColor);
+    }
+
+    // Show text in color, whatever the signals say. Returns the number of pixels written
+    uint32_t Draw(Arduino_GFX* pGfx, const char text, const uint16_t color)
+    {
+      // When nothing is shown, the screen is black, so every pixel of the new character has to be drawn
+      const bool bShown = (m_shownText != NotShown);
+      const uint32_t numPixels = DrawGlyphTransition(pGfx, *m_pFont, bShown ? m_shownText : text, bShown ? m_shownColor : BLACK, text, color,
+                                                     m_cursorX, m_cursorY, m_textSize);
+      m_shownText = text;
+      m_shownColor = color;
+      return numPixels;
+    }
+
+  private:
+    static const char NotShown = 0;
+
+    const GFXfont* m_pFont;
+    int16_t m_cursorX;
+    int16_t m_cursorY;
+    uint8_t m_textSize;
+    CarDataSignal m_text;
+    CarDataSignal m_color;
+    char m_shownText = NotShown;
+    uint16_t m_shownColor = BLACK;
+};
+
+// Two bars along the edge of the display that fill up from the bottom as the value goes from 0 to maxValue. The ring is the one
+// ArcSpans.h was generated for, see "make arc-spans"
+class RingGaugeWidget : public Widget
+{
+  public:
+    RingGaugeWidget(const int32_t maxValue, CarDataSignal value, CarDataSignal color) : m_maxValue(maxValue), m_value(value), m_color(color)
+    {
+    }
+
+    void Invalidate() override
+    {
+      m_shownEndDegree = NotShown;
+    }
+
+    void Update(Arduino_GFX* pGfx, const CarData& carData) override
+    {
+      const uint16_t color = uint16_t(m_color(carData));
+      const int32_t endDegree = EndDegree(carData);
+
+      if (m_shownEndDegree == NotShown || color != m_shownColor)
+      {
+        // Draw both bars completely in the new color
+        FillRing(pGfx, 0, endDegree, color);
+        FillRing(pGfx, endDegree, ArcSpanDegrees, BLACK);
+      }
+      else if (endDegree > m_shownEndDegree)
+      {
+        // Only extend the bars
+        FillRing(pGfx, m_shownEndDegree, endDegree, color);
+      }
+      else if (endDegree < m_shownEndDegree)
+      {
+        // Only clear the part of the bars that's no longer lit
+        FillRing(pGfx, endDegree, m_shownEndDegree, BLACK);
+      }
+
+      m_shownEndDegree = endDegree;
+      m_shownColor = color;
+    }
+
+    bool BeginRender(const CarData& carData) override
+    {
+      const uint16_t color = uint16_t(m_color(carData));
+      const int32_t endDegree = EndDegree(carData);
+      const bool bChanged = (endDegree != m_shownEndDegree || color != m_shownColor);
+      m_shownEndDegree = endDegree;
+      m_shownColor = color;
+      return bChanged;
+    }
+
+    // The spans are sorted by degree, not by row, so every band goes through all of the lit spans
+    void RenderRows(uint16_t* pPixels, const BandRect& band) const override
+    {
+      for (int32_t i = 0; i < ArcSpanStart[max(m_shownEndDegree, int32_t(0))]; i++)
+      {
+        const ArcSpan& span = ArcSpans[i];
+        if (span.Y >= band.Y && span.Y < band.Y + band.H)
+        {
+          uint16_t* pRow = pPixels + (span.Y - band.Y) * band.W - band.X;
+          const int16_t left = max<int16_t>(span.X, band.X);
+          const int16_t right = min<int16_t>(span.X + span.Length, band.X + band.W);
+          for (int16_t x = left; x < right; x++)
+          {
+            pRow[x] = m_shownColor;
+          }
+        }
+      }
+    }
+
+    // Fill the part of both bars between startDegree and endDegree, both in degrees from the bottom of the display [0..180]. The pixels
+    // come from the precomputed spans in ArcSpans.h, so there's no trigonometry involved and the cost only depends on the number of pixels
+    static void FillRing(Arduino_GFX* pGfx, int32_t startDegree, int32_t endDegree, const uint16_t color)
+    {
+      startDegree = max(startDegree, int32_t(0));
+      endDegree = min(endDegree, ArcSpanDegrees);
+      if (startDegree >= endDegree)
+      {
+        return;
+      }
+
+      // A horizontal line that is being built up from the spans of neighbouring degrees
+      struct ArcRun
+      {
+        uint8_t X;
+        uint8_t Length;
+      };
+
+      // The spans of neighbouring degrees on the same row of the same bar touch each other, so they're joined into a single line before
+      // being sent to the display. Indexed by [row][bar]
+      static ArcRun runs[256][2];
+      uint8_t minY = 0xFF;
+      uint8_t maxY = 0;
+
+      pGfx->startWrite();
+
+      for (int32_t i = ArcSpanStart[startDegree]; i < ArcSpanStart[endDegree]; i++)
+      {
+        const ArcSpan& span = ArcSpans[i];
+        ArcRun& run = runs[span.Y][span.X >= ArcSpansCenterX];
+        minY = min(minY, span.Y);
+        maxY = max(maxY, span.Y);
+
+        if (run.Length > 0 && span.X + span.Length == run.X)
+        {
+          run.X = span.X;
+          run.Length += span.Length;
+        }
+        else if (run.Length > 0 && run.X + run.Length == span.X)
+        {
+          run.Length += span.Length;
+        }
+        else
+        {
+          if (run.Length > 0)
+          {
+            pGfx->writeFastHLine(run.X, span.Y, run.Length, color);
+          }
+          run = { span.X, span.Length };
+        }
+      }
+
+      for (int32_t y = minY; y <= maxY; y++)
+      {
+        for (ArcRun& run : runs[y])
+        {
+          if (run.Length > 0)
+          {
+            pGfx->writeFastHLine(run.X, y, run.Length, color);
+            run.Length = 0;
+          }
+        }
+      }
+
+      pGfx->endWrite();
+    }
+
+  private:
+    static const int32_t NotShown = -1;
+
+    int32_t EndDegree(const CarData& carData) const
+    {
+      return (min(m_maxValue, m_value(carData)) / float(m_maxValue)) * ArcSpanDegrees;
+    }
+
+    int32_t m_maxValue;
+    CarDataSignal m_value;
+    CarDataSignal m_color;
+    int32_t m_shownEndDegree = NotShown;
+    uint16_t m_shownColor = BLACK;
+};
+
+struct NumericReadoutStats
+{
+  uint32_t Updates;         // Draws, i.e. updates in which the value or its color changed
+  uint32_t Chars;           // Characters drawn
+  uint64_t Pixels;          // Pixels written
+  uint32_t MaxPixels;       // Most pixels one update wrote
+};
+
+// A number, right aligned in a field of numChars characters of a monospaced GFXfont. The font needs glyphs for '0' to '9', and '-' for
+// negative numbers. A number that doesn't fit is shown as all 9s, or all 9s after a '-'. When the text is mirrored, the characters are
+// drawn from right to left, so the number reads correctly in the reflection.
+//
+// The widget remembers the character it drew at every position, so when the value changes, only the characters that are different are
+// drawn again. While the engine RPM climbs, that's mostly just the last one or two digits.
+class NumericReadoutWidget : public Widget
+{
+  public:
+    static constexpr int32_t MaxChars = 8;
+
+    NumericReadoutWidget(const GFXfont* pFont, const int16_t cursorX, const int16_t cursorY, const uint8_t textSize, const int32_t numChars,
+                         const bool bRightToLeft, CarDataSignal value, CarDataSignal color)
+      : m_pFont(pFont), m_cursorX(cursorX), m_cursorY(cursorY), m_textSize(textSize), m_numChars(min(numChars, MaxChars)),
+        m_bRightToLeft(bRightToLeft), m_value(value), m_color(color)
+    {
+    }
+
+    void Invalidate() override
+    {
+      m_bShown = false;
+    }
+
+    void Update(Arduino_GFX* pGfx, const CarData& carData) override
+    {
+      const int32_t value = m_value(carData);
+      const uint16_t color = uint16_t(m_color(carData));
+      if (!m_bShown || value != m_shownValue || color != m_shownColor)
+      {
+        Draw(pGfx, value, color);
+      }
+    }
+
+    bool BeginRender(const CarData& carData) override
+    {
+      const int32_t value = m_value(carData);
+      const uint16_t color = uint16_t(m_color(carData));
+      const bool bChanged = (!m_bShown || value != m_shownValue || color != m_shownColor);
+      FormatNumber(value, m_shownText);
+      m_shownValue = value;
+      m_shownColor = color;
+      m_bShown = true;
+      return bChanged;
+    }
+
+    void RenderRows(uint16_t* pPixels, const BandRect& band) const override
+    {
+      for (int32_t i = 0; i < m_numChars; i++)
+      {
+        if (m_shownText[i] != ' ')
+        {
+          RenderGlyphRows(pPixels, band, *m_pFont, m_shownText[i], CharCursorX(i), m_cursorY, m_textSize, m_shownColor);
+        }
+      }
+    }
+
+    // Show value in color, whatever the signals say. Only the characters that changed are drawn, and each of them by only writing the
+    // pixels that change, see GlyphTransition.h. Returns the number of pixels written
+    uint32_t Draw(Arduino_GFX* pGfx, const int32_t value, const uint16_t color)
+    {
+      char text[MaxChars];
+      FormatNumber(value, text);
+
+      uint32_t numPixels = 0;
+      for (int32_t i = 0; i < m_numChars; i++)
+      {
+        // The screen was cleared when the readout isn't shown
+        const char shownC = m_bShown ? m_shownText[i] : ' ';
+        if (text[i] == shownC && (text[i] == ' ' || color == m_shownColor))
+        {
+          continue;
+        }
+
+        // The font has no glyph for ' ', so a character that appears or disappears changes from or to itself in black
+        const char oldC = (shownC == ' ') ? text[i] : shownC;
+        const uint16_t oldColor = (shownC == ' ') ? BLACK : m_shownColor;
+        const char newC = (text[i] == ' ') ? shownC : text[i];
+        const uint16_t newColor = (text[i] == ' ') ? BLACK : color;
+        numPixels += DrawGlyphTransition(pGfx, *m_pFont, oldC, oldColor, newC, newColor, CharCursorX(i), m_cursorY, m_textSize);
+        m_stats.Chars++;
+      }
+
+      m_stats.Updates++;
+      m_stats.Pixels += numPixels;
+      m_stats.MaxPixels = max(m_stats.MaxPixels, numPixels);
+
+      memcpy(m_shownText, text, sizeof(text));
+      m_shownValue = value;
+      m_shownColor = color;
+      m_bShown = true;
+      return numPixels;
+    }
+
+    inline const NumericReadoutStats& Stats() const { return m_stats; }
+
+  private:
+    // Right aligned, padded with spaces
+    void FormatNumber(const int32_t value, char* pText) const
+    {
+      const bool bNegative = (value < 0);
+      const int32_t numDigits = bNegative ? m_numChars - 1 : m_numChars;
+      uint32_t magnitude = bNegative ? 0u - uint32_t(value) : uint32_t(value);
+
+      // Too many digits to fit, so show the largest number that fits
+      uint32_t limit = 1;
+      for (int32_t i = 0; i < numDigits; i++)
+      {
+        limit *= 10;
+      }
+      magnitude = min(magnitude, limit - 1);
+
+      int32_t i = m_numChars - 1;
+      do
+      {
+        pText[i--] = '0' + magnitude % 10;
+        magnitude /= 10;
+      } while (magnitude > 0 && i >= 0);
+
+      if (bNegative && i >= 0)
+      {
+        pText[i--] = '-';
+      }
+      for (; i >= 0; i--)
+      {
+        pText[i] = ' ';
+      }
+    }
+
+    // The cursor of character i of the text
+    int16_t CharCursorX(const int32_t i) const
+    {
+      const int16_t advance = m_pFont->glyph['0' - m_pFont->first].xAdvance * m_textSize;
+      return m_cursorX + (m_bRightToLeft ? m_numChars - 1 - i : i) * advance;
+    }
+
+    const GFXfont* m_pFont;
+    int16_t m_cursorX;
+    int16_t m_cursorY;
+    uint8_t m_textSize;
+    int32_t m_numChars;
+    bool m_bRightToLeft;
+    CarDataSignal m_value;
+    CarDataSignal m_color;
+    bool m_bShown = false;
+    int32_t m_shownValue = 0;
+    uint16_t m_shownColor = BLACK;
+    char m_shownText[MaxChars] = {};
+    NumericReadoutStats m_stats = { 0 };
+};
+
+// The color a sample is shown in
+typedef uint16_t (*SampleColorFunction)(int32_t value);
+
+struct HistoryStripStats
+{
+  uint32_t Samples;         // Samples read from the ring
+  uint32_t Columns;         // Columns drawn, which is fewer when a sample looks the same as the one in its column
+  uint64_t Pixels;          // Pixels written
+};
+
+// A strip chart of the last samples in a SampleRing, e.g. the engine RPM of the last seconds. Every sample is a bar from the bottom of the
+// strip, as high as the sample is relative to maxValue. The strip doesn't scroll: sample n always goes in column n % width, like the
+// sweep of an oscilloscope, so a new sample only costs writing its own column, as one block of height pixels, and replaces the sample
+// from width samples ago. The column after the newest sample is kept blank, so there's a gap between the newest and the oldest sample
+// that shows where the sweep is. That costs clearing one more column for every new sample, and the strip shows width - 1 samples. When
+// the text is mirrored, the columns go from right to left, so the strip reads correctly in the reflection.
+//
+// The samples don't come from the car data, but straight from the ring, which the core that collects the car data writes to.
+template <uint32_t Capacity>
+class HistoryStripWidget : public Widget
+{
+  public:
+    static constexpr int16_t MaxWidth = 240;
+    static constexpr int16_t MaxHeight = 64;
+
+    HistoryStripWidget(const SampleRing<Capacity>* pSamples, const int16_t x, const int16_t y, const int16_t width, const int16_t height,
+                       const int32_t maxValue, const bool bRightToLeft, SampleColorFunction color)
+      : m_pSamples(pSamples), m_x(x), m_y(y), m_width(min(width, MaxWidth)), m_height(min(height, MaxHeight)), m_maxValue(maxValue),
+        m_bRightToLeft(bRightToLeft), m_color(color)
+    {
+      static_assert(MaxHeight <= 255, "Bar heights are stored as uint8_t");
+    }
+
+    void Invalidate() override
+    {
+      m_bShown = false;
+    }
+
+    void Update(Arduino_GFX* pGfx, const CarData& carData) override
+    {
+      ReadSamples([this, pGfx](const int16_t column)
+      {
+        DrawColumn(pGfx, column);
+      });
+    }
+
+    bool BeginRender(const CarData& carData) override
+    {
+      bool bChanged = false;
+      ReadSamples([&bChanged](const int16_t column)
+      {
+        bChanged = true;
+      });
+      return bChanged;
+    }
+
+    void RenderRows(uint16_t* pPixels, const BandRect& band) const override
+    {
+      const int16_t top = max<int16_t>(band.Y, m_y);
+      const int16_t bottom = min<int16_t>(band.Y + band.H, m_y + m_height);
+
+      for (int16_t column = 0; column < m_width; column++)
+      {
+        const int16_t x = ColumnX(column);
+        if (x < band.X || x >= band.X + band.W)
+        {
+          continue;
+        }
+
+        for (int16_t y = max<int16_t>(top, m_y + m_height - m_barHeights[column]); y < bottom; y++)
+        {
+          pPixels[(y - band.Y) * band.W + x - band.X] = m_barColors[column];
+        }
+      }
+    }
+
+    inline const HistoryStripStats& Stats() const { return m_stats; }
+
+  private:
+    // Take the samples that are new since the last call into their columns, and call columnChanged(column) for every column that looks
+    // different now
+    template <typename ColumnChanged>
+    void ReadSamples(ColumnChanged columnChanged)
+    {
+      const uint32_t count = m_pSamples->Count();
+
+      // The screen was cleared, so every column that has a sample is drawn again. Older samples have been replaced anyway, or are in
+      // the gap
+      const uint32_t numShown = m_width - 1;
+      if (!m_bShown)
+      {
+        memset(m_barHeights, 0, sizeof(m_barHeights));
+        m_nextSample = count - min<uint32_t>(count, numShown);
+        m_bShown = true;
+      }
+      m_nextSample = max(m_nextSample, count - min<uint32_t>(count, numShown));
+
+      for (; m_nextSample != count; m_nextSample++)
+      {
+        int32_t value = 0;
+        if (!m_pSamples->Read(m_nextSample, value))
+        {
+          continue;
+        }
+        m_stats.Samples++;
+
+        const int16_t column = m_nextSample % m_width;
+        const uint8_t barHeight = uint8_t(min(max(value, int32_t(0)), m_maxValue) * m_height / m_maxValue);
+        const uint16_t barColor = m_color(value);
+        if (barHeight != m_barHeights[column] || (barHeight > 0 && barColor != m_barColors[column]))
+        {
+          m_barHeights[column] = barHeight;
+          m_barColors[column] = barColor;
+          columnChanged(column);
+        }
+      }
+
+      // The gap after the newest sample, which still shows the sample from width samples ago
+      const int16_t gap = count % m_width;
+      if (m_barHeights[gap] > 0)
+      {
+        m_barHeights[gap] = 0;
+        columnChanged(gap);
+      }
+    }
+
+    void DrawColumn(Arduino_GFX* pGfx, const int16_t column)
+    {
+      uint16_t pixels[MaxHeight];
+      for (int16_t row = 0; row < m_height; row++)
+      {
+        pixels[row] = (row >= m_height - m_barHeights[column]) ? m_barColors[column] : BLACK;
+      }
+      pGfx->draw16bitRGBBitmap(ColumnX(column), m_y, pixels, 1, m_height);
+
+      m_stats.Columns++;
+      m_stats.Pixels += m_height;
+    }
+
+    inline int16_t ColumnX(const int16_t column) const
+    {
+      return m_x + (m_bRightToLeft ? m_width - 1 - column : column);
+    }
+
+    const SampleRing<Capacity>* m_pSamples;
+    int16_t m_x;
+    int16_t m_y;
+    int16_t m_width;
+    int16_t m_height;
+    int32_t m_maxValue;
+    bool m_bRightToLeft;
+    SampleColorFunction m_color;
+    bool m_bShown = false;
+    uint32_t m_nextSample = 0;
+    uint8_t m_barHeights[MaxWidth] = {};
+    uint16_t m_barColors[MaxWidth] = {};
+    HistoryStripStats m_stats = { 0 };
+};
+
+#endif  // _WIDGETS
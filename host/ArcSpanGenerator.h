@@ -0,0 +1,169 @@
+// Generates ../ArcSpans.h, the scanline spans of the shift indicator ring used by RingGaugeWidget. The spans are found by drawing
+// the shift indicator the way the firmware originally did, with four fillArc() calls, once for every angle from 0 to 180 degrees. For
+// every pixel of the ring we note the smallest angle at which it's lit, so drawing from the table lights the same pixels as fillArc()
+// does on the host.
+//
+// The fillArc() of the host stand-in decides which pixels are inside the arc with atan2f(). The fillArcHelper() of Arduino_GFX compares
+// slopes instead, so on the device some pixels along the ends of the bars and the edges of the ring may come out differently. The table
+// hasn't been compared against the real library on hardware yet.
+//
+// Run "make arc-spans" after changing the geometry of the ring.
+
+#ifndef _HOST_ARC_SPAN_GENERATOR
+#define _HOST_ARC_SPAN_GENERATOR
+
+namespace Host
+{
+  const int16_t RingCenterX = 120;
+  const int16_t RingCenterY = 120;
+  const int16_t RingOuterRadius = 120;
+  const int16_t RingInnerRadius = 95;
+  const int32_t RingDegrees = 180;
+  const uint8_t NotInRing = 0xFF;
+
+  // The shift indicator as DrawShiftIndicator() drew it before ArcSpans.h existed
+  inline void FillArcShiftIndicator(const int32_t endRadius, const uint16_t color)
+  {
+    const uint16_t rotate = 90;
+
+    // Draw left side bar
+    gfx->fillArc(RingCenterX, RingCenterY, RingOuterRadius, RingInnerRadius, 0 + rotate, endRadius + rotate, color);
+    gfx->fillArc(RingCenterX, RingCenterY, RingOuterRadius, RingInnerRadius, endRadius + rotate, 180 + rotate, BLACK);
+
+    // Draw right side bar
+    gfx->fillArc(RingCenterX, RingCenterY, RingOuterRadius, RingInnerRadius, 360 - endRadius + rotate, 360 + rotate, color);
+    gfx->fillArc(RingCenterX, RingCenterY, RingOuterRadius, RingInnerRadius, 360 - 180 + rotate, 360 - endRadius + rotate, BLACK);
+  }
+
+  // For every pixel on the screen, the degree [0..179] that lights it, i.e. the pixel is lit when the bars end beyond that degree
+  inline bool FindRingDegrees(std::vector<uint8_t>& degrees)
+  {
+    const int16_t width = gfx->width();
+    const int16_t height = gfx->height();
+    degrees.assign(size_t(width) * height, NotInRing);
+
+    gfx->fillScreen(BLACK);
+
+    for (int32_t endRadius = 0; endRadius <= RingDegrees; endRadius++)
+    {
+      FillArcShiftIndicator(endRadius, WHITE);
+
+      for (int16_t y = 0; y < height; y++)
+      {
+        for (int16_t x = 0; x < width; x++)
+        {
+          const bool bIsLit = (Panel()->HostGetPixel(x, y) == WHITE);
+          uint8_t& degree = degrees[y * width + x];
+
+          if (bIsLit && degree == NotInRing)
+          {
+            if (endRadius == 0)
+            {
+              printf("Pixel %d,%d is lit with no RPM\n", x, y);
+              return false;
+            }
+            degree = uint8_t(endRadius - 1);
+          }
+          else if (!bIsLit && degree != NotInRing)
+          {
+            printf("Pixel %d,%d is lit at %d degrees, but not at %d degrees\n", x, y, degree + 1, endRadius);
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // Write ArcSpans.h: for every degree the horizontal spans of pixels it lights. Spans never cross the vertical center line, so each one
+  // belongs to either the left or the right bar
+  inline bool GenerateArcSpans(const char* filename)
+  {
+    TurnDisplayOn();
+
+    std::vector<uint8_t> degrees;
+    if (!FindRingDegrees(degrees))
+    {
+      return false;
+    }
+
+    struct Span { uint8_t Y; uint8_t X; uint8_t Length; };
+    std::vector<Span> spans;
+    std::vector<uint16_t> spanStart;
+
+    const int16_t width = gfx->width();
+    const int16_t height = gfx->height();
+
+    for (int32_t degree = 0; degree < RingDegrees; degree++)
+    {
+      spanStart.push_back(uint16_t(spans.size()));
+
+      for (int16_t y = 0; y < height; y++)
+      {
+        int16_t runStart = -1;
+        for (int16_t x = 0; x <= width; x++)
+        {
+          const bool bInRun = (x < width) && (degrees[y * width + x] == degree);
+          if (runStart >= 0 && (!bInRun || x == RingCenterX))
+          {
+            spans.push_back({ uint8_t(y), uint8_t(runStart), uint8_t(x - runStart) });
+            runStart = -1;
+          }
+          if (bInRun && runStart < 0)
+          {
+            runStart = x;
+          }
+        }
+      }
+    }
+    spanStart.push_back(uint16_t(spans.size()));
+
+    FILE* pFile = fopen(filename, "w");
+    if (pFile == nullptr)
+    {
+      printf("Failed to create %s\n", filename);
+      return false;
+    }
+
+    fprintf(pFile, "// Scanline spans of the shift indicator ring, center %d,%d, radius %d..%d. Generated by \"make arc-spans\" in the host folder,\n"
+                   "// see host/ArcSpanGenerator.h\n"
+                   "//\n"
+                   "// The spans of degree d are ArcSpans[ArcSpanStart[d]] up to ArcSpans[ArcSpanStart[d + 1]]. They are the pixels that are lit when\n"
+                   "// the bars end beyond d degrees, but not when they end at d degrees, where 0 is the bottom and 180 the top of the display\n\n"
+                   "#ifndef _ARC_SPANS\n"
+                   "#define _ARC_SPANS\n\n"
+                   "struct ArcSpan\n"
+                   "{\n"
+                   "  uint8_t Y;\n"
+                   "  uint8_t X;\n"
+                   "  uint8_t Length;\n"
+                   "};\n\n"
+                   "const int16_t ArcSpansCenterX = %d;   // Spans left of this are part of the left bar\n"
+                   "const int16_t ArcSpansCenterY = %d;\n"
+                   "const int16_t ArcSpansInnerRadius = %d;\n"
+                   "const int32_t ArcSpanDegrees = %d;\n"
+                   "const int32_t NumArcSpans = %zu;\n\n",
+            RingCenterX, RingCenterY, RingInnerRadius, RingOuterRadius, RingCenterX, RingCenterY, RingInnerRadius, RingDegrees, spans.size());
+
+    fprintf(pFile, "const uint16_t ArcSpanStart[ArcSpanDegrees + 1] = {");
+    for (size_t i = 0; i < spanStart.size(); i++)
+    {
+      fprintf(pFile, "%s%5u%s", (i % 12 == 0) ? "\n  " : " ", spanStart[i], (i + 1 < spanStart.size()) ? "," : "");
+    }
+    fprintf(pFile, " };\n\n");
+
+    fprintf(pFile, "const ArcSpan ArcSpans[NumArcSpans] = {");
+    for (size_t i = 0; i < spans.size(); i++)
+    {
+      fprintf(pFile, "%s{ %3u, %3u, %2u }%s", (i % 8 == 0) ? "\n  " : " ", spans[i].Y, spans[i].X, spans[i].Length, (i + 1 < spans.size()) ? "," : "");
+    }
+    fprintf(pFile, " };\n\n#endif  // _ARC_SPANS\n");
+
+    fclose(pFile);
+    printf("Wrote %zu spans to %s\n", spans.size(), filename);
+    return true;
+  }
+}
+
+#endif  // _HOST_ARC_SPAN_GENERATOR
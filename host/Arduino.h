@@ -0,0 +1,279 @@
+// Host-side (Linux) stand-in for the parts of the ESP32 Arduino core used by this project. Together with the other headers in this
+// folder it allows the firmware headers to be compiled and run unmodified on a PC, so the CAN decoding and drawing code can be profiled
+// and regression tested without a car.
+//
+// Time on the host is real time, optionally sped up with Host::SetTimeScale(), e.g. a time scale of 10 makes delay(4000) take 400ms.
+
+#ifndef _HOST_ARDUINO
+#define _HOST_ARDUINO
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using std::min;
+using std::max;
+
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define LOW     0x0
+#define HIGH    0x1
+#define INPUT   0x01
+#define OUTPUT  0x03
+
+// XIAO ESP32-S3 pin numbers
+#define LED_BUILTIN 21
+#define SS    44
+#define MOSI  9
+#define MISO  8
+#define SCK   7
+#define D0    1
+#define D1    2
+#define D2    3
+#define D3    4
+#define D4    5
+#define D5    6
+
+namespace Host
+{
+  // Real time is multiplied by this factor, i.e. values above 1 make the simulated device run faster than real time
+  inline std::atomic<double>& TimeScale()
+  {
+    static std::atomic<double> timeScale { 1.0 };
+    return timeScale;
+  }
+
+  inline void SetTimeScale(const double timeScale)
+  {
+    TimeScale() = (timeScale > 0.0) ? timeScale : 1.0;
+  }
+
+  inline std::chrono::steady_clock::time_point StartTime()
+  {
+    static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    return startTime;
+  }
+
+  // Monotonic real time in microseconds, used for measurements that should not be affected by the time scale
+  inline uint64_t RealMicros()
+  {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - StartTime()).count();
+  }
+
+  // CPU time consumed by the calling thread in microseconds
+  inline uint64_t ThreadCpuMicros()
+  {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return uint64_t(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+  }
+
+  // Sleep for a simulated duration. Tasks are given a chance to be suspended or deleted while sleeping (see HostFreeRTOS.h)
+  inline void SleepMicros(uint64_t simulatedMicros);
+
+  // State of the GPIO pins, only kept so it can be inspected
+  inline uint8_t* PinStates()
+  {
+    static uint8_t pinStates[64] = { 0 };
+    return pinStates;
+  }
+
+  inline uint32_t& CpuFrequencyMhz()
+  {
+    static uint32_t cpuFrequencyMhz = 240;
+    return cpuFrequencyMhz;
+  }
+
+  // ESP.restart() can't reboot a PC process, so it unwinds back to main() instead
+  struct Restart {};
+}
+
+inline unsigned long micros()
+{
+  return (unsigned long)(Host::RealMicros() * Host::TimeScale().load());
+}
+
+inline unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+inline void delay(uint32_t ms)
+{
+  Host::SleepMicros(uint64_t(ms) * 1000);
+}
+
+inline void delayMicroseconds(uint32_t us)
+{
+  Host::SleepMicros(us);
+}
+
+inline void yield()
+{
+  std::this_thread::yield();
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t value)
+{
+  Host::PinStates()[pin & 63] = value;
+}
+
+inline int digitalRead(uint8_t pin)
+{
+  return Host::PinStates()[pin & 63];
+}
+
+inline bool setCpuFrequencyMhz(uint32_t cpuFrequencyMhz)
+{
+  Host::CpuFrequencyMhz() = cpuFrequencyMhz;
+  return true;
+}
+
+inline uint32_t getCpuFrequencyMhz()
+{
+  return Host::CpuFrequencyMhz();
+}
+
+// Minimal version of the Arduino Print class, enough for printf() on the display and on Serial
+class Print
+{
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+      size_t n = 0;
+      while (size--)
+      {
+        n += write(*buffer++);
+      }
+      return n;
+    }
+
+    size_t write(const char* str)
+    {
+      return (str == nullptr) ? 0 : write((const uint8_t*)str, strlen(str));
+    }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)))
+    {
+      char buffer[256];
+      va_list args;
+      va_start(args, format);
+      int length = vsnprintf(buffer, sizeof(buffer), format, args);
+      va_end(args);
+
+      if (length < 0)
+      {
+        return 0;
+      }
+
+      return write((const uint8_t*)buffer, min(size_t(length), sizeof(buffer) - 1));
+    }
+
+    size_t print(const char* str) { return write(str); }
+    size_t print(char c) { return write(uint8_t(c)); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(double value) { return printf("%.2f", value); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T> size_t println(T value) { return print(value) + println(); }
+};
+
+// Serial output goes to stdout. There is no Serial input on the host
+class HostSerial : public Print
+{
+  public:
+    void begin(unsigned long baud) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+
+    size_t write(uint8_t c) override
+    {
+      return (fputc(c, stdout) == EOF) ? 0 : 1;
+    }
+
+    using Print::write;
+};
+
+inline HostSerial Serial;
+
+class EspClass
+{
+  public:
+    [[noreturn]] void restart() { throw Host::Restart(); }
+
+    // Real time, unaffected by the time scale, counted in cycles of the CPU frequency
+    uint32_t getCycleCount()
+    {
+      const uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Host::StartTime()).count();
+      return uint32_t(nanos * Host::CpuFrequencyMhz() / 1000);
+    }
+};
+
+inline EspClass ESP;
+
+// Memory capabilities of heap_caps_malloc(). The host has one kind of memory, so they're ignored
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT     (1 << 2)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+  return malloc(size);
+}
+
+inline void heap_caps_free(void* ptr)
+{
+  free(ptr);
+}
+
+namespace Host
+{
+  // Lets the host tools try what happens on a board without PSRAM
+  inline bool& PsramAvailable()
+  {
+    static bool bPsramAvailable = true;
+    return bPsramAvailable;
+  }
+}
+
+inline bool psramFound()
+{
+  return Host::PsramAvailable();
+}
+
+inline void* ps_malloc(size_t size)
+{
+  return malloc(size);
+}
+
+#include "HostFreeRTOS.h"
+
+#endif  // _HOST_ARDUINO
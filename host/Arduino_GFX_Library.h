@@ -0,0 +1,664 @@
+// Host-side stand-in for the parts of the Arduino_GFX library used by this project. The panel classes draw into an in-memory RGB565
+// framebuffer that mirrors the GRAM of the GC9A01, and the data bus counts the bytes a real SPI bus would have to transfer, so the
+// cost of the drawing code can be measured on a PC.
+//
+// Class names, method names and drawing algorithms follow Arduino_GFX, so the firmware compiles unmodified against this header.
+
+#ifndef _HOST_ARDUINO_GFX_LIBRARY
+#define _HOST_ARDUINO_GFX_LIBRARY
+
+#include <vector>
+
+#define GFX_NOT_DEFINED -1
+
+#define RGB565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | ((b) >> 3))
+#define RGB565_BLACK      RGB565(0, 0, 0)
+#define RGB565_DARKGREY   RGB565(128, 128, 128)
+#define RGB565_BLUE       RGB565(0, 0, 255)
+#define RGB565_GREEN      RGB565(0, 128, 0)
+#define RGB565_RED        RGB565(255, 0, 0)
+#define RGB565_YELLOW     RGB565(255, 255, 0)
+#define RGB565_WHITE      RGB565(255, 255, 255)
+
+#define BLACK     RGB565_BLACK
+#define DARKGREY  RGB565_DARKGREY
+#define BLUE      RGB565_BLUE
+#define GREEN     RGB565_GREEN
+#define RED       RGB565_RED
+#define YELLOW    RGB565_YELLOW
+#define WHITE     RGB565_WHITE
+
+#define GC9A01_TFTWIDTH   240
+#define GC9A01_TFTHEIGHT  240
+#define GC9A01_CASET      0x2A
+#define GC9A01_RASET      0x2B
+#define GC9A01_RAMWR      0x2C
+
+// Font data stored PER GLYPH
+typedef struct
+{
+  uint16_t bitmapOffset;  // Pointer into GFXfont->bitmap
+  uint8_t width;          // Bitmap dimensions in pixels
+  uint8_t height;         // Bitmap dimensions in pixels
+  uint8_t xAdvance;       // Distance to advance cursor (x axis)
+  int8_t xOffset;         // X dist from cursor pos to UL corner
+  int8_t yOffset;         // Y dist from cursor pos to UL corner
+} GFXglyph;
+
+// Data stored for FONT AS A WHOLE
+typedef struct
+{
+  uint8_t* bitmap;        // Glyph bitmaps, concatenated
+  GFXglyph* glyph;        // Glyph array
+  uint16_t first;         // ASCII extents (first char)
+  uint16_t last;          // ASCII extents (last char)
+  uint8_t yAdvance;       // Newline distance (y axis)
+} GFXfont;
+
+namespace Host
+{
+  // What a real SPI bus would have transferred
+  struct DisplayBusStats
+  {
+    uint64_t CommandBytes;      // Command bytes, i.e. bytes sent with DC low
+    uint64_t ParameterBytes;    // Command parameters, e.g. the coordinates of an address window
+    uint64_t PixelBytes;        // RGB565 pixel data
+    uint64_t AddressWindows;    // Number of RAMWR commands, i.e. how many separate regions were written
+
+    uint64_t TotalBytes() const { return CommandBytes + ParameterBytes + PixelBytes; }
+    uint64_t Pixels() const { return PixelBytes / 2; }
+  };
+
+  inline DisplayBusStats operator-(const DisplayBusStats& a, const DisplayBusStats& b)
+  {
+    return { a.CommandBytes - b.CommandBytes, a.ParameterBytes - b.ParameterBytes, a.PixelBytes - b.PixelBytes, a.AddressWindows - b.AddressWindows };
+  }
+
+  inline DisplayBusStats operator+(const DisplayBusStats& a, const DisplayBusStats& b)
+  {
+    return { a.CommandBytes + b.CommandBytes, a.ParameterBytes + b.ParameterBytes, a.PixelBytes + b.PixelBytes, a.AddressWindows + b.AddressWindows };
+  }
+}
+
+class Arduino_DataBus
+{
+  public:
+    virtual ~Arduino_DataBus() {}
+
+    virtual bool begin(int32_t speed = GFX_NOT_DEFINED, int8_t dataMode = GFX_NOT_DEFINED)
+    {
+      m_speed = (speed == GFX_NOT_DEFINED) ? 40000000 : speed;
+      return true;
+    }
+
+    virtual void beginWrite() {}
+    virtual void endWrite() {}
+
+    virtual void writeCommand(uint8_t c) { m_stats.CommandBytes++; }
+    virtual void write(uint8_t d) { m_stats.ParameterBytes++; }
+    virtual void write16(uint16_t d) { m_stats.ParameterBytes += 2; }
+    virtual void writeC8D16D16(uint8_t c, uint16_t d1, uint16_t d2) { writeCommand(c); write16(d1); write16(d2); }
+    virtual void writeRepeat(uint16_t p, uint32_t len) { m_stats.PixelBytes += len * 2; }
+    virtual void writePixels(uint16_t* data, uint32_t len) { m_stats.PixelBytes += len * 2; }
+
+    // ******** Host only **********************************
+
+    const Host::DisplayBusStats& HostStats() const { return m_stats; }
+
+    // Time the bytes transferred so far would have taken on the real SPI bus
+    uint64_t HostBusMicros() const { return m_stats.TotalBytes() * 8 * 1000000 / m_speed; }
+
+    void HostCountPixelWindow() { m_stats.AddressWindows++; }
+
+  protected:
+    Host::DisplayBusStats m_stats = { 0 };
+    int32_t m_speed = 40000000;
+};
+
+class Arduino_ESP32SPI : public Arduino_DataBus
+{
+  public:
+    Arduino_ESP32SPI(int8_t dc, int8_t cs = GFX_NOT_DEFINED, int8_t sck = GFX_NOT_DEFINED, int8_t mosi = GFX_NOT_DEFINED, int8_t miso = GFX_NOT_DEFINED,
+                     uint8_t spi_num = 1, bool is_shared_interface = true)
+    {
+    }
+};
+
+// The DMA version of the SPI bus sends pixels in larger transfers, but like the regular one it polls until every transfer is done, so the
+// CPU can't do anything else in the meantime. On the host, sending pixels keeps the thread busy for as long as the real bus would be
+class Arduino_ESP32SPIDMA : public Arduino_ESP32SPI
+{
+  public:
+    using Arduino_ESP32SPI::Arduino_ESP32SPI;
+
+    void writeRepeat(uint16_t p, uint32_t len) override
+    {
+      Arduino_ESP32SPI::writeRepeat(p, len);
+      WaitForTransfer(len * 2);
+    }
+
+    void writePixels(uint16_t* data, uint32_t len) override
+    {
+      Arduino_ESP32SPI::writePixels(data, len);
+      WaitForTransfer(len * 2);
+    }
+
+  private:
+    void WaitForTransfer(const uint32_t numBytes)
+    {
+      Host::BusyWaitMicros(uint64_t(numBytes) * 8 * 1000000 / m_speed);
+    }
+};
+
+class Arduino_GFX : public Print
+{
+  public:
+    Arduino_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h)
+    {
+    }
+
+    virtual bool begin(int32_t speed = GFX_NOT_DEFINED) = 0;
+    virtual void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+
+    virtual void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      for (int16_t j = y; j < y + h; j++)
+      {
+        for (int16_t i = x; i < x + w; i++)
+        {
+          writePixelPreclipped(i, j, color);
+        }
+      }
+    }
+
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+      writeFillRect(x, y, 1, h, color);
+    }
+
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+      writeFillRect(x, y, w, 1, color);
+    }
+
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      if (ClipRect(x, y, w, h))
+      {
+        writeFillRectPreclipped(x, y, w, h, color);
+      }
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color)
+    {
+      if (x >= 0 && y >= 0 && x < _width && y < _height)
+      {
+        writePixelPreclipped(x, y, color);
+      }
+    }
+
+    virtual void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h)
+    {
+      startWrite();
+      for (int16_t j = 0; j < h; j++)
+      {
+        for (int16_t i = 0; i < w; i++)
+        {
+          writePixel(x + i, y + j, bitmap[j * w + i]);
+        }
+      }
+      endWrite();
+    }
+
+    virtual void setRotation(uint8_t r)
+    {
+      _rotation = r & 3;
+      _width = (_rotation & 1) ? HEIGHT : WIDTH;
+      _height = (_rotation & 1) ? WIDTH : HEIGHT;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color)
+    {
+      startWrite();
+      writePixel(x, y, color);
+      endWrite();
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+      startWrite();
+      writeFastHLine(x, y, w, color);
+      endWrite();
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+      startWrite();
+      writeFastVLine(x, y, h, color);
+      endWrite();
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      startWrite();
+      writeFillRect(x, y, w, h, color);
+      endWrite();
+    }
+
+    void fillScreen(uint16_t color)
+    {
+      fillRect(0, 0, _width, _height, color);
+    }
+
+    // Same approach as Arduino_GFX: the ring segment is filled with one horizontal line per row and per run of pixels inside the angles
+    void fillArc(int16_t x, int16_t y, int16_t r1, int16_t r2, float start, float end, uint16_t color)
+    {
+      if (r1 < r2)
+      {
+        std::swap(r1, r2);
+      }
+      r1 = max<int16_t>(r1, 1);
+      r2 = max<int16_t>(r2, 1);
+
+      start = fmodf(start, 360);
+      end = fmodf(end, 360);
+      if (start < 0)
+      {
+        start += 360;
+      }
+      if (end < 0)
+      {
+        end += 360;
+      }
+
+      startWrite();
+      if (start > end)
+      {
+        fillArcHelper(x, y, r1, r2, start, 360, color);
+        fillArcHelper(x, y, r1, r2, 0, end, color);
+      }
+      else
+      {
+        fillArcHelper(x, y, r1, r2, start, end, color);
+      }
+      endWrite();
+    }
+
+    void setCursor(int16_t x, int16_t y)
+    {
+      cursor_x = x;
+      cursor_y = y;
+    }
+
+    void setTextColor(uint16_t c)
+    {
+      textcolor = textbgcolor = c;
+    }
+
+    void setTextColor(uint16_t c, uint16_t bg)
+    {
+      textcolor = c;
+      textbgcolor = bg;
+    }
+
+    void setTextSize(uint8_t s)
+    {
+      textsize_x = textsize_y = max<uint8_t>(s, 1);
+    }
+
+    void setTextWrap(bool w)
+    {
+      wrap = w;
+    }
+
+    void setFont(const GFXfont* f)
+    {
+      gfxFont = (GFXfont*)f;
+    }
+
+    size_t write(uint8_t c) override
+    {
+      if (gfxFont == nullptr)
+      {
+        return 1;
+      }
+
+      if (c == '\n')
+      {
+        cursor_x = 0;
+        cursor_y += int16_t(textsize_y) * gfxFont->yAdvance;
+      }
+      else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last)
+      {
+        const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+        if (glyph->width > 0 && glyph->height > 0)
+        {
+          if (wrap && (cursor_x + textsize_x * (glyph->xOffset + glyph->width)) > _width)
+          {
+            cursor_x = 0;
+            cursor_y += int16_t(textsize_y) * gfxFont->yAdvance;
+          }
+          drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        }
+        cursor_x += glyph->xAdvance * int16_t(textsize_x);
+      }
+
+      return 1;
+    }
+
+    using Print::write;
+
+    // Draw a character of a GFXfont. Like Arduino_GFX, every set pixel is written on its own, as a size_x * size_y rectangle
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
+    {
+      const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+      const uint8_t* bitmap = gfxFont->bitmap;
+      uint32_t bo = glyph->bitmapOffset;
+      uint8_t bits = 0;
+      uint8_t bit = 0;
+      int16_t xo16 = glyph->xOffset;
+      int16_t yo16 = glyph->yOffset;
+
+      startWrite();
+      for (uint8_t yy = 0; yy < glyph->height; yy++)
+      {
+        for (uint8_t xx = 0; xx < glyph->width; xx++)
+        {
+          if (!(bit++ & 7))
+          {
+            bits = bitmap[bo++];
+          }
+          if (bits & 0x80)
+          {
+            if (size_x == 1 && size_y == 1)
+            {
+              writePixel(x + xo16 + xx, y + yo16 + yy, color);
+            }
+            else
+            {
+              writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+            }
+          }
+          bits <<= 1;
+        }
+      }
+      endWrite();
+    }
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+    uint8_t getRotation() const { return _rotation; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+
+  protected:
+    // Clip a rectangle to the screen. Returns false if nothing is left
+    bool ClipRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h)
+    {
+      if (w < 0)
+      {
+        x += w + 1;
+        w = -w;
+      }
+      if (h < 0)
+      {
+        y += h + 1;
+        h = -h;
+      }
+
+      int16_t x2 = min<int16_t>(x + w, _width);
+      int16_t y2 = min<int16_t>(y + h, _height);
+      x = max<int16_t>(x, 0);
+      y = max<int16_t>(y, 0);
+      w = x2 - x;
+      h = y2 - y;
+
+      return (w > 0) && (h > 0);
+    }
+
+    // Decides which pixels are inside the arc with atan2f(), which is close to, but not pixel for pixel the same as, the slope
+    // comparisons of the real library
+    void fillArcHelper(int16_t cx, int16_t cy, int16_t oradius, int16_t iradius, float start, float end, uint16_t color)
+    {
+      if (start >= end)
+      {
+        return;
+      }
+
+      const int32_t or2 = int32_t(oradius) * oradius + oradius;
+      const int32_t ir = iradius - 1;
+      const int32_t ir2 = ir * ir + ir;
+
+      for (int32_t dy = -oradius; dy <= oradius; dy++)
+      {
+        int32_t runStart = INT32_MIN;
+
+        for (int32_t dx = -oradius; dx <= oradius + 1; dx++)
+        {
+          bool bInside = false;
+          const int32_t d2 = dx * dx + dy * dy;
+          if (dx <= oradius && d2 <= or2 && d2 > ir2)
+          {
+            float angle = atan2f(dy, dx) * RAD_TO_DEG;
+            if (angle < 0)
+            {
+              angle += 360;
+            }
+            bInside = (angle >= start) && (angle <= end);
+          }
+
+          if (bInside && runStart == INT32_MIN)
+          {
+            runStart = dx;
+          }
+          else if (!bInside && runStart != INT32_MIN)
+          {
+            writeFastHLine(cx + runStart, cy + dy, dx - runStart, color);
+            runStart = INT32_MIN;
+          }
+        }
+      }
+    }
+
+    const int16_t WIDTH;
+    const int16_t HEIGHT;
+    int16_t _width;
+    int16_t _height;
+    uint8_t _rotation = 0;
+    int16_t cursor_x = 0;
+    int16_t cursor_y = 0;
+    uint16_t textcolor = 0xFFFF;
+    uint16_t textbgcolor = 0xFFFF;
+    uint8_t textsize_x = 1;
+    uint8_t textsize_y = 1;
+    bool wrap = true;
+    GFXfont* gfxFont = nullptr;
+};
+
+class Arduino_TFT;
+
+namespace Host
+{
+  // The most recently created panel, so the host tools can look at what ended up on the screen
+  inline Arduino_TFT*& Panel()
+  {
+    static Arduino_TFT* pPanel = nullptr;
+    return pPanel;
+  }
+}
+
+// A TFT panel with its own memory (GRAM) that is written through a data bus. The host version keeps the GRAM in memory
+class Arduino_TFT : public Arduino_GFX
+{
+  public:
+    Arduino_TFT(Arduino_DataBus* bus, int8_t rst, uint8_t r, bool ips, int16_t w, int16_t h) : Arduino_GFX(w, h), _bus(bus), _gram(w * h, 0)
+    {
+      _rotation = r;
+      Host::Panel() = this;
+    }
+
+    bool begin(int32_t speed = GFX_NOT_DEFINED) override
+    {
+      _currentX = _currentY = _currentW = _currentH = -1;
+      return _bus->begin(speed);
+    }
+
+    void setRotation(uint8_t r) override
+    {
+      Arduino_GFX::setRotation(r);
+      _currentX = _currentY = _currentW = _currentH = -1;
+      _bus->writeCommand(0x36);   // MADCTL
+      _bus->write(0);
+    }
+
+    void writePixelPreclipped(int16_t x, int16_t y, uint16_t color) override
+    {
+      writeAddrWindow(x, y, 1, 1);
+      _bus->writePixels(&color, 1);
+      SetGramPixel(x, y, color);
+    }
+
+    void writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+      writeAddrWindow(x, y, w, h);
+      _bus->writeRepeat(color, uint32_t(w) * h);
+      for (int16_t j = y; j < y + h; j++)
+      {
+        for (int16_t i = x; i < x + w; i++)
+        {
+          SetGramPixel(i, j, color);
+        }
+      }
+    }
+
+    void draw16bitRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) override
+    {
+      if (x < 0 || y < 0 || x + w > _width || y + h > _height)
+      {
+        Arduino_GFX::draw16bitRGBBitmap(x, y, bitmap, w, h);
+        return;
+      }
+
+      startWrite();
+      writeAddrWindow(x, y, w, h);
+      _bus->writePixels(bitmap, uint32_t(w) * h);
+      for (int16_t j = 0; j < h; j++)
+      {
+        for (int16_t i = 0; i < w; i++)
+        {
+          SetGramPixel(x + i, y + j, bitmap[j * w + i]);
+        }
+      }
+      endWrite();
+    }
+
+    // Like Arduino_GC9A01, the column and row addresses are only sent when they change
+    virtual void writeAddrWindow(int16_t x, int16_t y, uint16_t w, uint16_t h)
+    {
+      if (x != _currentX || w != _currentW)
+      {
+        _bus->writeC8D16D16(GC9A01_CASET, x, x + w - 1);
+        _currentX = x;
+        _currentW = w;
+      }
+      if (y != _currentY || h != _currentH)
+      {
+        _bus->writeC8D16D16(GC9A01_RASET, y, y + h - 1);
+        _currentY = y;
+        _currentH = h;
+      }
+      _bus->writeCommand(GC9A01_RAMWR);
+      _bus->HostCountPixelWindow();
+    }
+
+    // ******** Host only **********************************
+
+    Arduino_DataBus* HostBus() { return _bus; }
+
+    // GRAM in the panel's native orientation, WIDTH x HEIGHT pixels
+    const uint16_t* HostGram() const { return _gram.data(); }
+
+    uint16_t HostGetPixel(int16_t x, int16_t y) const
+    {
+      MapToGram(x, y);
+      return _gram[y * WIDTH + x];
+    }
+
+    // Save what's on the screen as a binary PPM image
+    bool HostSavePPM(const char* filename) const
+    {
+      FILE* pFile = fopen(filename, "wb");
+      if (pFile == nullptr)
+      {
+        return false;
+      }
+
+      fprintf(pFile, "P6\n%d %d\n255\n", _width, _height);
+      for (int16_t y = 0; y < _height; y++)
+      {
+        for (int16_t x = 0; x < _width; x++)
+        {
+          uint16_t c = HostGetPixel(x, y);
+          uint8_t rgb[3] = { uint8_t((c >> 8) & 0xF8), uint8_t((c >> 3) & 0xFC), uint8_t((c << 3) & 0xF8) };
+          fwrite(rgb, 1, 3, pFile);
+        }
+      }
+
+      fclose(pFile);
+      return true;
+    }
+
+    // FNV-1a hash of the GRAM, handy to check that two ways of drawing produce exactly the same picture
+    uint32_t HostGramHash() const
+    {
+      uint32_t hash = 2166136261u;
+      for (uint16_t c : _gram)
+      {
+        hash = (hash ^ (c & 0xFF)) * 16777619u;
+        hash = (hash ^ (c >> 8)) * 16777619u;
+      }
+      return hash;
+    }
+
+  protected:
+    // The panel rotates in hardware, so the GRAM stays in the native orientation
+    void MapToGram(int16_t& x, int16_t& y) const
+    {
+      int16_t t;
+      switch (_rotation)
+      {
+        case 1: t = x; x = WIDTH - 1 - y; y = t; break;
+        case 2: x = WIDTH - 1 - x; y = HEIGHT - 1 - y; break;
+        case 3: t = x; x = y; y = HEIGHT - 1 - t; break;
+        default: break;
+      }
+    }
+
+    void SetGramPixel(int16_t x, int16_t y, uint16_t color)
+    {
+      MapToGram(x, y);
+      _gram[y * WIDTH + x] = color;
+    }
+
+    Arduino_DataBus* _bus;
+    std::vector<uint16_t> _gram;
+    int16_t _currentX = -1;
+    int16_t _currentY = -1;
+    int16_t _currentW = -1;
+    int16_t _currentH = -1;
+};
+
+class Arduino_GC9A01 : public Arduino_TFT
+{
+  public:
+    Arduino_GC9A01(Arduino_DataBus* bus, int8_t rst = GFX_NOT_DEFINED, uint8_t r = 0, bool ips = false, int16_t w = GC9A01_TFTWIDTH, int16_t h = GC9A01_TFTHEIGHT,
+                   uint8_t col_offset1 = 0, uint8_t row_offset1 = 0, uint8_t col_offset2 = 0, uint8_t row_offset2 = 0)
+      : Arduino_TFT(bus, rst, r, ips, w, h)
+    {
+    }
+};
+
+#endif  // _HOST_ARDUINO_GFX_LIBRARY
@@ -0,0 +1,1407 @@
+// Benchmarks that exercise parts of the firmware on their own. Each benchmark prints its results and returns true on success
+
+#ifndef _HOST_BENCHMARKS
+#define _HOST_BENCHMARKS
+
+#include "CanTraceReplay.h"
+#include "ArcSpanGenerator.h"
+#include "FontSubsetGenerator.h"
+#include "GearSprites.h"
+#include "GlyphRuns.h"
+#include "GlyphBlit.h"
+#include "MirrorText.h"
+#include <thread>
+
+namespace Host
+{
+  // --------------------------------------------------------
+  // ******** CollectCarData() throughput *******************
+  // --------------------------------------------------------
+
+  // Replay a trace into CollectCarData() and measure how many frames per second it reads. Returns the CAN bus counters of the run and the
+  // real time the replay took. Since frames can't be read faster than they're replayed, that's also the time it took to read them
+  inline CanBusStats RunCollectCarData(const std::vector<TimedCanFrame>& frames, const double speed, uint64_t& realMicros, CollectCarDataStats& collect)
+  {
+    const CanBusStats before = ESP32Can.HostStats();
+    const CollectCarDataStats collectBefore = g_CollectCarDataStats;
+    g_CollectCarDataStats.MaxFramesPerBatch = 0;
+
+    SetupCollectCarData();
+
+    CanTraceReplay replay;
+    replay.Start(frames, speed);
+
+    while (!replay.IsDone() || ESP32Can.inRxQueue() > 0)
+    {
+      CollectCarData();
+    }
+
+    replay.Stop();
+    realMicros = max<uint64_t>(replay.Stats().RealMicros, 1);
+    ESP32Can.end();
+
+    CanBusStats stats = ESP32Can.HostStats();
+    stats.FramesOnBus -= before.FramesOnBus;
+    stats.FramesFiltered -= before.FramesFiltered;
+    stats.FramesQueued -= before.FramesQueued;
+    stats.FramesDropped -= before.FramesDropped;
+    stats.FramesRead -= before.FramesRead;
+
+    collect = g_CollectCarDataStats;
+    collect.Batches -= collectBefore.Batches;
+    collect.Frames -= collectBefore.Frames;
+    collect.Publishes -= collectBefore.Publishes;
+    return stats;
+  }
+
+  inline void PrintCollectCarDataRun(const char* speedName, const CanBusStats& stats, const uint64_t realMicros, const CollectCarDataStats& collect)
+  {
+    printf("  %-8s %12.0f %12.0f %10llu %10u %8.1f %12.0f\n", speedName, stats.FramesOnBus * 1000000.0 / realMicros,
+           stats.FramesRead * 1000000.0 / realMicros, (unsigned long long)stats.FramesDropped, stats.MaxQueueDepth,
+           collect.Batches ? double(collect.Frames) / collect.Batches : 0.0, collect.Publishes * 1000000.0 / realMicros);
+  }
+
+  // Measure the throughput of CollectCarData() for a trace: first as fast as possible, then at increasing speeds until frames get dropped.
+  // A speed of 0 means "sweep", otherwise only the given speed is measured
+  inline bool BenchmarkCollectCarData(const std::vector<TimedCanFrame>& frames, const double speed)
+  {
+    const uint64_t durationMicros = max<uint64_t>(CanTraceDurationMicros(frames), 1);
+    printf("CollectCarData() throughput: %zu frames, %.1f s, %.0f frames/s at 1x\n\n", frames.size(), durationMicros / 1000000.0,
+           frames.size() * 1000000.0 / durationMicros);
+
+    // How much of the trace the firmware actually decodes
+    for (int i = 0; i < NumCanIDs; i++)
+    {
+      size_t count = 0;
+      for (const TimedCanFrame& frame : frames)
+      {
+        count += (frame.Frame.identifier == CanIDs[i].ID && frame.Frame.data_length_code == 8) ? 1 : 0;
+      }
+      printf("  %-16s %#05x %8zu frames\n", CanIDs[i].Name, CanIDs[i].ID, count);
+    }
+
+    printf("\n  %-8s %12s %12s %10s %10s %8s %12s\n", "Speed", "Offered/s", "Read/s", "Dropped", "Max queue", "Batch", "Publishes/s");
+
+    uint64_t realMicros = 0;
+    CollectCarDataStats collect;
+    CanBusStats stats = RunCollectCarData(frames, ReplayAsFastAsPossible, realMicros, collect);
+    PrintCollectCarDataRun("max", stats, realMicros, collect);
+
+    if (speed > 0.0)
+    {
+      char speedName[16];
+      snprintf(speedName, sizeof(speedName), "%gx", speed);
+      stats = RunCollectCarData(frames, speed, realMicros, collect);
+      PrintCollectCarDataRun(speedName, stats, realMicros, collect);
+      return true;
+    }
+
+    // Start at a speed that takes about a second, then double until frames are dropped
+    double sweepSpeed = 1.0;
+    while (durationMicros / sweepSpeed > 1000000.0)
+    {
+      sweepSpeed *= 2.0;
+    }
+
+    for (; sweepSpeed <= 65536.0; sweepSpeed *= 2.0)
+    {
+      char speedName[16];
+      snprintf(speedName, sizeof(speedName), "%gx", sweepSpeed);
+      stats = RunCollectCarData(frames, sweepSpeed, realMicros, collect);
+      PrintCollectCarDataRun(speedName, stats, realMicros, collect);
+
+      if (stats.FramesDropped > 0)
+      {
+        break;
+      }
+    }
+
+    return true;
+  }
+
+  // --------------------------------------------------------
+  // ******** CAN ID dispatch *******************************
+  // --------------------------------------------------------
+
+  // A larger CanIDs[] table, like the one we'd have after adding many more decoded signals
+  constexpr size_t NumManyCanIDs = 48;
+  constexpr auto ManyCanIDs = []()
+  {
+    struct { CanID Entries[NumManyCanIDs]; } canIDs {};
+    for (size_t i = 0; i < NumManyCanIDs; i++)
+    {
+      canIDs.Entries[i] = { "Signal", uint32_t(0x400 + i * 13), &CalcEngineRPM, PrintEngineRPM };
+    }
+    canIDs.Entries[NumManyCanIDs - 1].ID = 0x204;
+    return canIDs;
+  }();
+  constexpr auto manyCanIDsDispatch = GenerateCanIDDispatchTable<ExtendedDispatchTableSize(ManyCanIDs.Entries)>(ManyCanIDs.Entries);
+
+  // Time finding the CanIDs[] entry of every frame in the trace, returns nanoseconds per frame
+  template <typename Find>
+  double TimeCanIDLookup(const std::vector<TimedCanFrame>& frames, Find find)
+  {
+    const int repeat = 200;
+    uint32_t found = 0;
+
+    const uint64_t startMicros = RealMicros();
+    for (int r = 0; r < repeat; r++)
+    {
+      for (const TimedCanFrame& frame : frames)
+      {
+        found += find(frame.Frame);
+      }
+    }
+    const uint64_t realMicros = RealMicros() - startMicros;
+
+    // Make sure the compiler can't skip the lookups
+    volatile uint32_t sink = found;
+    (void)sink;
+
+    return realMicros * 1000.0 / (double(repeat) * max<size_t>(frames.size(), 1));
+  }
+
+  template <size_t N, typename Table>
+  void BenchmarkCanIDLookup(const std::vector<TimedCanFrame>& frames, const CanID (&canIDs)[N], const Table& table)
+  {
+    const double linearNanos = TimeCanIDLookup(frames, [&canIDs](const CanFrame& frame)
+    {
+      for (size_t i = 0; i < N; i++)
+      {
+        if (frame.identifier == canIDs[i].ID)
+        {
+          return uint32_t(i);
+        }
+      }
+      return uint32_t(NoCanID);
+    });
+
+    const double dispatchNanos = TimeCanIDLookup(frames, [&table](const CanFrame& frame)
+    {
+      return uint32_t(table.Find(frame.identifier, frame.extd));
+    });
+
+    printf("  %3zu CAN IDs %14.2f %14.2f\n", N, linearNanos, dispatchNanos);
+  }
+
+  // Compare the linear scan CollectCarData() used to do with the dispatch table, for the firmware's CanIDs[] and a much larger table
+  inline bool BenchmarkCanIDDispatch(const std::vector<TimedCanFrame>& frames)
+  {
+    printf("CAN ID lookup: %zu frames, nanoseconds per frame\n\n", frames.size());
+    printf("  %-11s %14s %14s\n", "", "Linear scan", "Dispatch");
+    BenchmarkCanIDLookup(frames, CanIDs, canIDDispatch);
+    BenchmarkCanIDLookup(frames, ManyCanIDs.Entries, manyCanIDsDispatch);
+    return true;
+  }
+
+  // --------------------------------------------------------
+  // ******** CAN acceptance filter *************************
+  // --------------------------------------------------------
+
+  // Show the acceptance filter generated from CanIDs[] and how much of a trace it lets through. Fails if a frame the firmware decodes
+  // would be rejected by the filter
+  inline bool ReportAcceptanceFilter(const std::vector<TimedCanFrame>& frames)
+  {
+    const CanAcceptanceFilter filter = GenerateAcceptanceFilter(CanIDs);
+    printf("CAN acceptance filter: code = %#010x, mask = %#010x, %s filter\n", filter.Config.acceptance_code, filter.Config.acceptance_mask,
+           filter.Config.single_filter ? "single" : "dual");
+    printf("  Accepts %llu of %llu possible CAN IDs\n\n", (unsigned long long)filter.NumAcceptedIDs, (unsigned long long)filter.NumPossibleIDs);
+
+    size_t numAccepted = 0;
+    size_t numDecoded = 0;
+    size_t numDecodedRejected = 0;
+    for (const TimedCanFrame& frame : frames)
+    {
+      const bool bAccepted = TwaiFilterAccepts(filter.Config, frame.Frame);
+      const bool bDecoded = (canIDDispatch.Find(frame.Frame.identifier, frame.Frame.extd) != NoCanID);
+      numAccepted += bAccepted ? 1 : 0;
+      numDecoded += bDecoded ? 1 : 0;
+      numDecodedRejected += (bDecoded && !bAccepted) ? 1 : 0;
+    }
+
+    const double total = max<size_t>(frames.size(), 1);
+    printf("  Frames in trace    %10zu\n", frames.size());
+    printf("  Frames accepted    %10zu (%.1f%%)\n", numAccepted, numAccepted * 100.0 / total);
+    printf("  Frames decoded     %10zu (%.1f%%)\n", numDecoded, numDecoded * 100.0 / total);
+    printf("  Decoded, rejected  %10zu\n", numDecodedRejected);
+
+    return numDecodedRejected == 0;
+  }
+
+  // --------------------------------------------------------
+  // ******** CarData shared between cores ******************
+  // --------------------------------------------------------
+
+  // Every CarData written by the stress test has fields that can be checked against each other, so a reader can tell when it got a mix
+  // of two writes
+  inline CarData MakeStressCarData(const uint32_t i)
+  {
+    return { int32_t(i), int32_t(i * 7 + 1), int32_t(~i) };
+  }
+
+  inline bool IsConsistentStressCarData(const CarData& data)
+  {
+    const uint32_t i = uint32_t(data.EngineRPM);
+    return data.CurrentGear == int32_t(i * 7 + 1) && data.GearboxMode == int32_t(~i);
+  }
+
+  struct CarDataStressResult
+  {
+    uint64_t Writes;
+    uint64_t Reads;
+    uint64_t Retries;
+    uint64_t TornReads;
+  };
+
+  // One thread writes as fast as it can while the others read, for the given time. write(i) and read(data, retries) do the actual sharing
+  template <typename Write, typename Read>
+  CarDataStressResult StressCarData(const int numReaders, const uint64_t durationMicros, Write write, Read read)
+  {
+    std::atomic<bool> bStop { false };
+    std::atomic<uint64_t> reads { 0 };
+    std::atomic<uint64_t> retries { 0 };
+    std::atomic<uint64_t> tornReads { 0 };
+    uint64_t writes = 0;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < numReaders; r++)
+    {
+      readers.emplace_back([&]()
+      {
+        uint64_t localReads = 0;
+        uint64_t localRetries = 0;
+        uint64_t localTornReads = 0;
+
+        while (!bStop.load(std::memory_order_relaxed))
+        {
+          CarData data;
+          localRetries += read(data);
+          localTornReads += IsConsistentStressCarData(data) ? 0 : 1;
+          localReads++;
+        }
+
+        reads += localReads;
+        retries += localRetries;
+        tornReads += localTornReads;
+      });
+    }
+
+    const uint64_t startMicros = RealMicros();
+    while (RealMicros() - startMicros < durationMicros)
+    {
+      for (int i = 0; i < 1000; i++)
+      {
+        write(MakeStressCarData(uint32_t(++writes)));
+      }
+    }
+
+    bStop = true;
+    for (std::thread& reader : readers)
+    {
+      reader.join();
+    }
+
+    return { writes, reads.load(), retries.load(), tornReads.load() };
+  }
+
+  inline void PrintCarDataStressResult(const char* name, const CarDataStressResult& result, const uint64_t durationMicros)
+  {
+    printf("  %-16s %14.0f %14.0f %12llu %12llu\n", name, result.Writes * 1000000.0 / durationMicros, result.Reads * 1000000.0 / durationMicros,
+           (unsigned long long)result.Retries, (unsigned long long)result.TornReads);
+  }
+
+  // Hammer g_SharedCarData from one writer and several readers and check that no reader ever sees a half written CarData. To show that
+  // the check would catch it, the same is done with plain copies that aren't synchronized
+  inline bool StressSharedCarData()
+  {
+    const uint64_t durationMicros = 2000000;
+    const int numReaders = max(1, int(std::thread::hardware_concurrency()) - 1);
+    printf("CarData shared between cores: 1 writer, %d reader%s, %.0f s each\n\n", numReaders, (numReaders == 1) ? "" : "s", durationMicros / 1000000.0);
+    printf("  %-16s %14s %14s %12s %12s\n", "", "Writes/s", "Reads/s", "Retries", "Torn reads");
+
+    // Start out with a consistent CarData, like the unsynchronized copy below, since readers may run before the first write
+    SeqLock<CarData> seqLock;
+    seqLock.Write(MakeStressCarData(0));
+    const CarDataStressResult seqLockResult = StressCarData(numReaders, durationMicros,
+      [&seqLock](const CarData& data) { seqLock.Write(data); },
+      [&seqLock](CarData& data) { return seqLock.Read(data); });
+    PrintCarDataStressResult("SeqLock", seqLockResult, durationMicros);
+
+    // Relaxed atomics, so the race is well defined, but nothing keeps the three fields together
+    std::atomic<int32_t> unsynchronized[3] = { { 0 }, { 1 }, { -1 } };
+    const CarDataStressResult unsynchronizedResult = StressCarData(numReaders, durationMicros,
+      [&unsynchronized](const CarData& data)
+      {
+        unsynchronized[0].store(data.EngineRPM, std::memory_order_relaxed);
+        unsynchronized[1].store(data.CurrentGear, std::memory_order_relaxed);
+        unsynchronized[2].store(data.GearboxMode, std::memory_order_relaxed);
+      },
+      [&unsynchronized](CarData& data)
+      {
+        data = { unsynchronized[0].load(std::memory_order_relaxed), unsynchronized[1].load(std::memory_order_relaxed),
+                 unsynchronized[2].load(std::memory_order_relaxed) };
+        return 0;
+      });
+    PrintCarDataStressResult("Unsynchronized", unsynchronizedResult, durationMicros);
+
+    const bool bPassed = (seqLockResult.TornReads == 0 && seqLockResult.Reads > 0);
+    printf("\n%s\n", bPassed ? "No torn reads" : "FAILED: torn reads with SeqLock");
+    return bPassed;
+  }
+
+  // --------------------------------------------------------
+  // ******** Shift indicator *******************************
+  // --------------------------------------------------------
+
+  struct ShiftIndicatorRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    std::vector<uint32_t> ScreenHashes;   // Screen after every frame
+  };
+
+  enum class ShiftIndicatorMode
+  {
+    FillArc,        // Four fillArc() calls every frame, like DrawShiftIndicator() originally did
+    FullRedraw,     // The shift indicator widget, but drawing the whole indicator every frame
+    Incremental,    // The shift indicator widget
+  };
+
+  // Draw the shift indicator once for every RPM in the list, starting from a black screen
+  inline ShiftIndicatorRun RunShiftIndicator(const std::vector<int32_t>& engineRPMs, const ShiftIndicatorMode mode)
+  {
+    ShiftIndicatorRun run;
+    Arduino_TFT* pPanel = Panel();
+
+    gfx->fillScreen(RGB565_BLACK);
+    shiftIndicator.Invalidate();
+    memset(&carData, 0, sizeof(carData));
+
+    const DisplayBusStats before = pPanel->HostBus()->HostStats();
+    run.CpuMicros = 0;
+
+    for (const int32_t engineRPM : engineRPMs)
+    {
+      const uint64_t startMicros = ThreadCpuMicros();
+
+      carData.EngineRPM = engineRPM;
+      if (mode == ShiftIndicatorMode::FillArc)
+      {
+        const int32_t endRadius = (min(MaxRPM, carData.EngineRPM) / float(MaxRPM)) * 180.0f;
+        FillArcShiftIndicator(endRadius, ShiftIndicatorColor(engineRPM));
+      }
+      else
+      {
+        if (mode == ShiftIndicatorMode::FullRedraw)
+        {
+          shiftIndicator.Invalidate();
+        }
+        shiftIndicator.Update(gfx, carData);
+      }
+
+      run.CpuMicros += ThreadCpuMicros() - startMicros;
+      run.ScreenHashes.push_back(pPanel->HostGramHash());
+    }
+
+    run.Bus = pPanel->HostBus()->HostStats() - before;
+    return run;
+  }
+
+  inline void PrintShiftIndicatorRun(const char* name, const ShiftIndicatorRun& run, const size_t numFrames)
+  {
+    const double frames = max<size_t>(numFrames, 1);
+    printf("  %-12s %12.0f %12.0f %12.1f %12.1f %12.1f\n", name, run.Bus.Pixels() / frames, run.Bus.TotalBytes() / frames,
+           run.Bus.AddressWindows / frames, run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / frames, run.CpuMicros / frames);
+  }
+
+  // Compare the ways of drawing the shift indicator for every engine RPM frame in the trace. Fails if the screen ever ends up different
+  inline bool BenchmarkShiftIndicator(const std::vector<TimedCanFrame>& frames)
+  {
+    std::vector<int32_t> engineRPMs;
+    for (const TimedCanFrame& frame : frames)
+    {
+      if (frame.Frame.identifier == 0x204 && frame.Frame.data_length_code == 8)
+      {
+        engineRPMs.push_back(CalcEngineRPM(frame.Frame.data));
+      }
+    }
+
+    TurnDisplayOn();
+
+    printf("\nShift indicator: %zu frames, per frame\n\n", engineRPMs.size());
+    printf("  %-12s %12s %12s %12s %12s %12s\n", "", "Pixels", "SPI bytes", "Windows", "SPI us", "CPU us");
+
+    const ShiftIndicatorRun fillArc = RunShiftIndicator(engineRPMs, ShiftIndicatorMode::FillArc);
+    PrintShiftIndicatorRun("fillArc()", fillArc, engineRPMs.size());
+
+    const ShiftIndicatorRun full = RunShiftIndicator(engineRPMs, ShiftIndicatorMode::FullRedraw);
+    PrintShiftIndicatorRun("Full redraw", full, engineRPMs.size());
+
+    const ShiftIndicatorRun incremental = RunShiftIndicator(engineRPMs, ShiftIndicatorMode::Incremental);
+    PrintShiftIndicatorRun("Incremental", incremental, engineRPMs.size());
+
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < engineRPMs.size(); i++)
+    {
+      numDifferent += (fillArc.ScreenHashes[i] != full.ScreenHashes[i] || fillArc.ScreenHashes[i] != incremental.ScreenHashes[i]) ? 1 : 0;
+    }
+
+    printf("\n  Frames where the screens differ: %zu\n", numDifferent);
+    return numDifferent == 0;
+  }
+
+  // --------------------------------------------------------
+  // ******** Double-buffered display transfers *************
+  // --------------------------------------------------------
+
+  // Render a band of full width rows of the shift indicator ring, testing every pixel with atan2f() like the host's fillArc() does, so
+  // rendering takes a realistic amount of CPU time
+  inline void RenderRingBand(uint16_t* pBuffer, const int16_t width, const int16_t y, const int16_t rows, const int32_t endRadius, const uint16_t color)
+  {
+    const int32_t or2 = int32_t(RingOuterRadius) * RingOuterRadius + RingOuterRadius;
+    const int32_t ir = RingInnerRadius - 1;
+    const int32_t ir2 = ir * ir + ir;
+
+    for (int16_t j = 0; j < rows; j++)
+    {
+      for (int16_t i = 0; i < width; i++)
+      {
+        const int32_t dx = i - RingCenterX;
+        const int32_t dy = y + j - RingCenterY;
+        const int32_t d2 = dx * dx + dy * dy;
+        uint16_t pixel = BLACK;
+
+        if (d2 <= or2 && d2 > ir2)
+        {
+          // Degrees from the bottom of the ring, on either side
+          const float degrees = fabsf(atan2f(dx, dy)) * RAD_TO_DEG;
+          pixel = (degrees < endRadius) ? color : BLACK;
+        }
+
+        pBuffer[j * width + i] = pixel;
+      }
+    }
+  }
+
+  struct DisplayTransferRun
+  {
+    uint64_t RealMicros;
+    uint64_t RenderMicros;
+    uint32_t ScreenHash;
+  };
+
+  // Render a sweep of the RPM range as full screen frames, in bands, either sending every band before rendering the next, or through
+  // the double-buffered pipeline
+  inline DisplayTransferRun RunDisplayTransfer(Arduino_TFT& panel, DisplayTransferPipeline* pPipeline, const int numFrames, const int16_t bandRows)
+  {
+    const int16_t width = panel.width();
+    const int16_t height = panel.height();
+    std::vector<uint16_t> syncBuffer(size_t(width) * bandRows);
+    DisplayTransferRun run = { 0, 0, 0 };
+
+    const uint64_t startMicros = RealMicros();
+    for (int frame = 0; frame < numFrames; frame++)
+    {
+      const int32_t engineRPM = frame * MaxRPM / max(numFrames - 1, 1);
+      const int32_t endRadius = engineRPM * 180 / MaxRPM;
+
+      for (int16_t y = 0; y < height; y += bandRows)
+      {
+        const int16_t rows = min<int16_t>(bandRows, height - y);
+        uint16_t* pBuffer = pPipeline ? pPipeline->AcquireBuffer() : syncBuffer.data();
+
+        const uint64_t renderStartMicros = RealMicros();
+        RenderRingBand(pBuffer, width, y, rows, endRadius, ShiftIndicatorColor(engineRPM));
+        run.RenderMicros += RealMicros() - renderStartMicros;
+
+        if (pPipeline)
+        {
+          pPipeline->Submit(pBuffer, 0, y, width, rows);
+        }
+        else
+        {
+          panel.draw16bitRGBBitmap(0, y, pBuffer, width, rows);
+        }
+      }
+
+      if (pPipeline)
+      {
+        pPipeline->Flush();
+      }
+    }
+
+    run.RealMicros = RealMicros() - startMicros;
+    run.ScreenHash = panel.HostGramHash();
+    return run;
+  }
+
+  // Measure how much of the time spent sending pixels over the DMA SPI bus is hidden behind rendering when using DisplayTransferPipeline
+  inline bool BenchmarkDisplayTransfer()
+  {
+    const int numFrames = 60;
+    const int16_t bandRows = 16;
+
+    SetTimeScale(1.0);
+    Arduino_ESP32SPIDMA dmaBus(GC9A01_DC, GC9A01_CS, GC9A01_SCK, GC9A01_MOSI, GC9A01_MISO);
+    Arduino_GC9A01 panel(&dmaBus, GC9A01_RST, 0, true);
+    panel.begin();
+
+    printf("Display transfers: %d full screen frames, rendered in bands of %d rows, over a %d MHz DMA SPI bus\n\n", numFrames, bandRows, 40);
+    printf("  %-14s %12s %12s %12s %12s %12s\n", "", "Frame us", "Render us", "Transfer us", "Wait us", "Overlap us");
+
+    const DisplayTransferRun sync = RunDisplayTransfer(panel, nullptr, numFrames, bandRows);
+    const double syncBusMicros = dmaBus.HostBusMicros();
+    printf("  %-14s %12.0f %12.0f %12.0f %12s %12s\n", "Synchronous", sync.RealMicros / double(numFrames), sync.RenderMicros / double(numFrames),
+           syncBusMicros / numFrames, "-", "0");
+
+    DisplayTransferPipeline pipeline;
+    if (!pipeline.Begin(&panel, uint32_t(panel.width()) * bandRows, xPortGetCoreID()))
+    {
+      return false;
+    }
+
+    const DisplayTransferRun pipelined = RunDisplayTransfer(panel, &pipeline, numFrames, bandRows);
+    const DisplayTransferStats& stats = pipeline.Stats();
+    printf("  %-14s %12.0f %12.0f %12.0f %12.0f %12.0f\n", "Double-buffered", pipelined.RealMicros / double(numFrames),
+           pipelined.RenderMicros / double(numFrames), stats.TransferMicros / double(numFrames), stats.WaitMicros / double(numFrames),
+           stats.OverlapMicros() / double(numFrames));
+    pipeline.End();
+
+    // The transfer task stands in for the other core, and keeps a CPU busy while it sends
+    if (std::thread::hardware_concurrency() < 2)
+    {
+      printf("\n  This host has a single CPU, so rendering can't overlap with sending");
+    }
+
+    const bool bSameScreen = (sync.ScreenHash == pipelined.ScreenHash);
+    printf("\n  Screens %s\n", bSameScreen ? "match" : "DIFFER");
+    return bSameScreen;
+  }
+
+  // --------------------------------------------------------
+  // ******** Gear text *************************************
+  // --------------------------------------------------------
+
+  // How the gear was drawn before DrawGlyphTransition(): from sprites cached in PSRAM, or from the glyph runs without PSRAM
+
+  const int32_t GearNotShown = -12;   // A randomly chosen number that isn't a gear
+
+  // The gear characters as runs of pixels, see GlyphRuns.h
+#ifdef MIRROR_TEXT_FOR_HOLOGRAPHIC_REFLECTION
+  constexpr const uint8_t (&GearFontBitmapBytes)[sizeof(GearFontBitmaps)] = MirroredGearFontBitmaps.Bytes;
+#else
+  constexpr const uint8_t (&GearFontBitmapBytes)[sizeof(GearFontBitmaps)] = GearFontBitmaps;
+#endif
+  constexpr size_t NumGearFontGlyphs = sizeof(GearFontGlyphs) / sizeof(GearFontGlyphs[0]);
+  constexpr FontRuns<CountFontRuns(GearFontBitmapBytes, GearFontGlyphs), NumGearFontGlyphs> GearFontRuns PROGMEM =
+    EncodeFontRuns<CountFontRuns(GearFontBitmapBytes, GearFontGlyphs)>(GearFontBitmapBytes, GearFontGlyphs);
+
+  const uint16_t GearTextColors[] = { WHITE, RED };
+  GearSpriteCache gearSprites;
+
+  // True if no part of the rectangle is covered by the shift indicator ring
+  inline bool IsInsideRing(const SpriteRect& rect)
+  {
+    const int32_t maxDistance2 = int32_t(ArcSpansInnerRadius - 1) * (ArcSpansInnerRadius - 1);
+    const int32_t dx = max(abs(rect.X - ArcSpansCenterX), abs(rect.X + rect.W - 1 - ArcSpansCenterX));
+    const int32_t dy = max(abs(rect.Y - ArcSpansCenterY), abs(rect.Y + rect.H - 1 - ArcSpansCenterY));
+    return dx * dx + dy * dy <= maxDistance2;
+  }
+
+  // Replace the gear that's currently shown. The sprite covers both the old and the new gear, so the old one is erased at the same time
+  inline void DrawGearSprite(const int32_t oldGear, const int32_t gear, const uint16_t color)
+  {
+    const char text = GenerateGearText(gear);
+    const SpriteRect rect = gearSprites.CharRect(text);
+    const SpriteRect oldRect = gearSprites.CharRect(GenerateGearText(oldGear));
+    const SpriteRect bothRect = UnionRect(oldRect, rect);
+
+    gfx->startWrite();
+    if (IsInsideRing(bothRect))
+    {
+      gearSprites.Draw(gfx, bothRect, text, color);
+    }
+    else
+    {
+      // A rectangle around both characters would overwrite part of the ring
+      gearSprites.Draw(gfx, oldRect, text, color);
+      gearSprites.Draw(gfx, rect, text, color);
+    }
+    gfx->endWrite();
+  }
+
+  // Replace the gear that's currently shown by erasing the old one and drawing the new one from the glyph runs. Sends fewer pixels than a
+  // sprite, but the old gear briefly disappears. Without PSRAM, DrawGearText() did this instead of drawing a sprite
+  inline void DrawGearRuns(const int32_t oldGear, const int32_t gear, const uint16_t color)
+  {
+    if (oldGear != gear)
+    {
+      DrawGlyphRuns(gfx, *pGearFont, GearFontRuns, GenerateGearText(oldGear), GearTextX, GearTextY, GearTextSize, BLACK);
+    }
+    DrawGlyphRuns(gfx, *pGearFont, GearFontRuns, GenerateGearText(gear), GearTextX, GearTextY, GearTextSize, color);
+  }
+
+  enum class GearTextMode
+  {
+    Printf,           // Erase the old gear with gfx->printf() in black, then print the new one, like DrawGearText() originally did
+    Sprite,           // DrawGearSprite() with the sprites cached in PSRAM
+    SpriteNoPsram,    // DrawGearSprite() rendering the sprite every time
+    GlyphRuns,        // DrawGearRuns()
+    Transition,       // The gear text widget, which uses DrawGlyphTransition()
+  };
+
+  struct GearTextRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    std::vector<uint32_t> ScreenHashes;   // Screen after every change
+    uint64_t GearChangePixels;            // Pixels the gear text widget wrote when the gear changed
+    uint64_t ColorChangePixels;           // And when only the color changed
+    uint32_t NumGearChanges;
+    uint32_t NumColorChanges;
+  };
+
+  // Show every gear after every other gear, alternating between the two colors, starting from a black screen
+  inline GearTextRun RunGearText(const GearTextMode mode, std::vector<std::pair<int32_t, uint16_t>>& changes)
+  {
+    const int32_t gears[] = { Park, Reverse, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    changes.clear();
+    for (const int32_t from : gears)
+    {
+      for (const int32_t to : gears)
+      {
+        changes.push_back({ from, WHITE });
+        changes.push_back({ to, (changes.size() & 2) ? RED : WHITE });
+      }
+    }
+
+    GearTextRun run = {};
+    Arduino_TFT* pPanel = Panel();
+    gfx->fillScreen(BLACK);
+
+    const DisplayBusStats before = pPanel->HostBus()->HostStats();
+    run.CpuMicros = 0;
+    int32_t shownGear = GearNotShown;
+    uint16_t shownColor = WHITE;
+    GearTextWidget gearTextWidget(pGearFont, GearTextX, GearTextY, GearTextSize, GearTextSignal, GearColorSignal);
+
+    for (const std::pair<int32_t, uint16_t>& change : changes)
+    {
+      const uint64_t startMicros = ThreadCpuMicros();
+
+      if (mode == GearTextMode::Transition)
+      {
+        const uint32_t numPixels = gearTextWidget.Draw(gfx, GenerateGearText(change.first), change.second);
+        if (change.first != shownGear)
+        {
+          run.GearChangePixels += numPixels;
+          run.NumGearChanges++;
+        }
+        else if (change.second != shownColor)
+        {
+          run.ColorChangePixels += numPixels;
+          run.NumColorChanges++;
+        }
+      }
+      else if (mode == GearTextMode::GlyphRuns)
+      {
+        DrawGearRuns(shownGear, change.first, change.second);
+      }
+      else if (mode == GearTextMode::Printf)
+      {
+        if (change.first != shownGear)
+        {
+          gfx->setCursor(GearTextX, GearTextY);
+          gfx->setTextColor(BLACK);
+          gfx->printf("%c", GenerateGearText(shownGear));
+        }
+        gfx->setCursor(GearTextX, GearTextY);
+        gfx->setTextColor(change.second);
+        gfx->printf("%c", GenerateGearText(change.first));
+      }
+      else
+      {
+        DrawGearSprite(shownGear, change.first, change.second);
+      }
+
+      run.CpuMicros += ThreadCpuMicros() - startMicros;
+      run.ScreenHashes.push_back(pPanel->HostGramHash());
+      shownGear = change.first;
+      shownColor = change.second;
+    }
+
+    run.Bus = pPanel->HostBus()->HostStats() - before;
+    return run;
+  }
+
+  inline void PrintGearTextRun(const char* name, const GearTextRun& run, const size_t numChanges)
+  {
+    const double changes = max<size_t>(numChanges, 1);
+    const double busMicros = run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / changes;
+    printf("  %-18s %10.0f %10.0f %10.1f %10.1f %10.1f %10.1f\n", name, run.Bus.Pixels() / changes, run.Bus.TotalBytes() / changes,
+           run.Bus.AddressWindows / changes, busMicros, run.CpuMicros / changes, busMicros + run.CpuMicros / changes);
+  }
+
+  enum class GlyphBlitMode
+  {
+    Printf,           // gfx->printf("%c", c)
+    DrawChar,         // gfx->drawChar(), without the string formatting, but still one rectangle per pixel
+    DrawGlyph,        // DrawGlyph() straight from the font's tables
+  };
+
+  struct GlyphBlitRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    std::vector<uint32_t> ScreenHashes;   // Screen after every character
+  };
+
+  // Draw every gear character numRepeats times on a black screen, only timing the drawing itself
+  inline GlyphBlitRun RunGlyphBlit(const GlyphBlitMode mode, const uint32_t numRepeats)
+  {
+    GlyphBlitRun run;
+    run.CpuMicros = 0;
+    run.Bus = {};
+
+    gfx->setFont(pGearFont);
+    gfx->setTextSize(GearTextSize);
+    for (const char* pChar = GearTextCharacters; *pChar != 0; pChar++)
+    {
+      for (uint32_t i = 0; i < numRepeats; i++)
+      {
+        gfx->fillScreen(BLACK);
+        const uint16_t color = (i & 1) ? RED : WHITE;
+        const DisplayBusStats before = Panel()->HostBus()->HostStats();
+        const uint64_t startMicros = ThreadCpuMicros();
+
+        if (mode == GlyphBlitMode::Printf)
+        {
+          gfx->setCursor(GearTextX, GearTextY);
+          gfx->setTextColor(color);
+          gfx->printf("%c", *pChar);
+        }
+        else if (mode == GlyphBlitMode::DrawChar)
+        {
+          gfx->drawChar(GearTextX, GearTextY, *pChar, color, color, GearTextSize, GearTextSize);
+        }
+        else
+        {
+          DrawChar(gfx, *pGearFont, *pChar, GearTextX, GearTextY, GearTextSize, color);
+        }
+
+        run.CpuMicros += ThreadCpuMicros() - startMicros;
+        run.Bus = run.Bus + (Panel()->HostBus()->HostStats() - before);
+      }
+      run.ScreenHashes.push_back(Panel()->HostGramHash());
+    }
+    return run;
+  }
+
+  // Compare drawing a gear character with gfx->printf() against drawing the glyph straight from the font. Fails if the screens differ
+  inline bool BenchmarkGlyphBlit()
+  {
+    const uint32_t numRepeats = 20;
+    const size_t numDraws = strlen(GearTextCharacters) * numRepeats;
+
+    printf("\nGear characters drawn on a black screen, per character\n\n");
+    printf("  %-18s %10s %10s %10s %10s\n", "", "Pixels", "Windows", "SPI us", "CPU us");
+
+    const struct
+    {
+      const char* Name;
+      GlyphBlitMode Mode;
+    } modes[] =
+    {
+      { "printf()", GlyphBlitMode::Printf },
+      { "drawChar()", GlyphBlitMode::DrawChar },
+      { "DrawGlyph()", GlyphBlitMode::DrawGlyph },
+    };
+
+    std::vector<GlyphBlitRun> runs;
+    for (const auto& mode : modes)
+    {
+      runs.push_back(RunGlyphBlit(mode.Mode, numRepeats));
+      const GlyphBlitRun& run = runs.back();
+      printf("  %-18s %10.0f %10.1f %10.1f %10.2f\n", mode.Name, run.Bus.Pixels() / double(numDraws), run.Bus.AddressWindows / double(numDraws),
+             run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / numDraws, run.CpuMicros / double(numDraws));
+    }
+
+    size_t numDifferent = 0;
+    for (const GlyphBlitRun& run : runs)
+    {
+      numDifferent += (run.ScreenHashes != runs[0].ScreenHashes) ? 1 : 0;
+    }
+
+    printf("\n  Ways of drawing that end up with a different screen than printf(): %zu\n", numDifferent);
+    return numDifferent == 0;
+  }
+
+  // Compare printing the gear with gfx->printf() against drawing it from the sprite cache. Fails if the screen ever ends up different
+  inline bool BenchmarkGearText()
+  {
+    SetupDisplay();
+    TurnDisplayOn();
+
+    std::vector<std::pair<int32_t, uint16_t>> changes;
+    printf("\nGear text changes, per change\n\n");
+    printf("  %-18s %10s %10s %10s %10s %10s %10s\n", "", "Pixels", "SPI bytes", "Windows", "SPI us", "CPU us", "Latency us");
+
+    const GearTextRun printfRun = RunGearText(GearTextMode::Printf, changes);
+    PrintGearTextRun("printf()", printfRun, changes.size());
+
+    gearSprites.Begin(pGearFont, GearTextX, GearTextY, GearTextSize, GearTextCharacters, GearTextColors,
+                      sizeof(GearTextColors) / sizeof(GearTextColors[0]));
+    const GearTextRun spriteRun = RunGearText(GearTextMode::Sprite, changes);
+    PrintGearTextRun("Sprite, PSRAM", spriteRun, changes.size());
+
+    // Without PSRAM every sprite is rendered when it's drawn
+    PsramAvailable() = false;
+    gearSprites.End();
+    gearSprites.Begin(pGearFont, GearTextX, GearTextY, GearTextSize, GearTextCharacters, GearTextColors,
+                      sizeof(GearTextColors) / sizeof(GearTextColors[0]));
+    const GearTextRun noPsramRun = RunGearText(GearTextMode::SpriteNoPsram, changes);
+    PrintGearTextRun("Sprite, no PSRAM", noPsramRun, changes.size());
+
+    const GearTextRun runsRun = RunGearText(GearTextMode::GlyphRuns, changes);
+    PrintGearTextRun("Glyph runs", runsRun, changes.size());
+
+    const GearTextRun transitionRun = RunGearText(GearTextMode::Transition, changes);
+    PrintGearTextRun("Transition", transitionRun, changes.size());
+
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < changes.size(); i++)
+    {
+      const uint32_t hash = printfRun.ScreenHashes[i];
+      numDifferent += (hash != spriteRun.ScreenHashes[i] || hash != noPsramRun.ScreenHashes[i] || hash != runsRun.ScreenHashes[i] ||
+                       hash != transitionRun.ScreenHashes[i]) ? 1 : 0;
+    }
+
+    printf("\n  Transition pixels per gear change %.0f, per color change %.0f\n", double(transitionRun.GearChangePixels) / max(transitionRun.NumGearChanges, 1u),
+           double(transitionRun.ColorChangePixels) / max(transitionRun.NumColorChanges, 1u));
+    printf("  Glyph runs %zu bytes, bitmaps %zu bytes\n", sizeof(GearFontRuns), sizeof(GearFontBitmaps));
+
+    printf("\n  Changes where the screens differ: %zu of %zu\n", numDifferent, changes.size());
+    return BenchmarkGlyphBlit() && numDifferent == 0;
+  }
+  // --------------------------------------------------------
+  // ******** Display frames ********************************
+  // --------------------------------------------------------
+
+  // The car data DisplayInfo() would see after every engine RPM frame of the trace
+  inline std::vector<CarData> DisplayCarData(const std::vector<TimedCanFrame>& frames)
+  {
+    std::vector<CarData> displayCarData;
+    for (const TimedCanFrame& frame : frames)
+    {
+      DecodeCanFrame(frame.Frame);
+      if (frame.Frame.identifier == 0x204 && frame.Frame.data_length_code == 8)
+      {
+        PublishCarData();
+        CopyCarData();
+        displayCarData.push_back(carData);
+      }
+    }
+    return displayCarData;
+  }
+
+  struct DisplayFrameRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    uint64_t MaxPixels;                   // Most pixels one frame sent
+    std::vector<uint32_t> ScreenHashes;   // Screen after every frame
+  };
+
+  // Draw every frame like DisplayInfo() does, straight to the display, into pCanvas if it isn't nullptr, or with pScanlines if that isn't
+  // nullptr. With bRedraw, every frame clears the screen and draws everything
+  inline DisplayFrameRun RunDisplayFrames(const std::vector<CarData>& displayCarData, DisplayCanvas* pCanvas, ScanlineRenderer* pScanlines,
+                                          const bool bRedraw)
+  {
+    Arduino_GFX* const pPreviousGfx = gfx;
+    gfx = pCanvas ? pCanvas : gfx;
+
+    TurnDisplayOn();
+    if (pCanvas)
+    {
+      pCanvas->Flush();
+    }
+    if (pScanlines)
+    {
+      pScanlines->Begin(gfx, xPortGetCoreID());
+    }
+
+    DisplayFrameRun run;
+    Arduino_TFT* pPanel = Panel();
+    const DisplayBusStats before = pPanel->HostBus()->HostStats();
+    run.CpuMicros = 0;
+    run.MaxPixels = 0;
+
+    for (const CarData& frameCarData : displayCarData)
+    {
+      const uint64_t frameBusPixels = pPanel->HostBus()->HostStats().Pixels();
+      const uint64_t startMicros = ThreadCpuMicros();
+
+      carData = frameCarData;
+      if (bRedraw)
+      {
+        // Rendering bands already clears the screen
+        if (!pScanlines)
+        {
+          gfx->fillScreen(BLACK);
+        }
+        InvalidateScreen();
+      }
+
+      if (pScanlines)
+      {
+        RenderScreen(*pScanlines, frameTiming.Now());
+      }
+      else
+      {
+        DrawScreen(frameTiming.Now());
+      }
+      if (pCanvas)
+      {
+        pCanvas->Flush();
+      }
+
+      run.CpuMicros += ThreadCpuMicros() - startMicros;
+      run.MaxPixels = max(run.MaxPixels, pPanel->HostBus()->HostStats().Pixels() - frameBusPixels);
+      run.ScreenHashes.push_back(pPanel->HostGramHash());
+    }
+
+    run.Bus = pPanel->HostBus()->HostStats() - before;
+    if (pScanlines)
+    {
+      pScanlines->End();
+    }
+    gfx = pPreviousGfx;
+    return run;
+  }
+
+  inline void PrintDisplayFrameRun(const char* name, const DisplayFrameRun& run, const size_t numFrames)
+  {
+    const double frames = max<size_t>(numFrames, 1);
+    printf("  %-18s %10.0f %10llu %10.0f %10.1f %10.1f %10.1f\n", name, run.Bus.Pixels() / frames, (unsigned long long)run.MaxPixels,
+           run.Bus.TotalBytes() / frames, run.Bus.AddressWindows / frames, run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / frames,
+           run.CpuMicros / frames);
+  }
+
+  struct GearFlashRun
+  {
+    uint64_t Pixels;
+    uint64_t CpuMicros;
+    uint32_t ScreenHash;
+  };
+
+  // Flash the gear red and back numFlashes times on an indexed canvas, by drawing it in the other color, or with bRecolor by drawing it
+  // once in its own palette entry and only changing the color of that entry
+  inline GearFlashRun RunGearFlash(const uint32_t numFlashes, const bool bRecolor)
+  {
+    const uint16_t gearKey = 0x0821;
+    static uint16_t flashColor;
+    flashColor = WHITE;
+    CarDataSignal colorSignal = bRecolor ? [](const CarData&) -> int32_t { return gearKey; } : [](const CarData&) -> int32_t { return flashColor; };
+    GearTextWidget flashingGear(pGearFont, GearTextX, GearTextY, GearTextSize, GearTextSignal, colorSignal);
+
+    IndexedCanvas<4> canvas(Panel());
+    Arduino_GFX* const pPreviousGfx = gfx;
+    gfx = &canvas;
+    TurnDisplayOn();
+    flashingGear.Update(gfx, carData);
+    canvas.Recolor(gearKey, flashColor);
+    canvas.Flush();
+
+    Arduino_TFT* pPanel = Panel();
+    const uint64_t pixelsBefore = pPanel->HostBus()->HostStats().Pixels();
+    const uint64_t startMicros = ThreadCpuMicros();
+    for (uint32_t i = 0; i < 2 * numFlashes; i++)
+    {
+      flashColor = (flashColor == WHITE) ? RED : WHITE;
+      if (bRecolor)
+      {
+        canvas.Recolor(gearKey, flashColor);
+      }
+      else
+      {
+        flashingGear.Update(gfx, carData);
+      }
+      canvas.Flush();
+    }
+
+    GearFlashRun run = { pPanel->HostBus()->HostStats().Pixels() - pixelsBefore, ThreadCpuMicros() - startMicros, pPanel->HostGramHash() };
+    gfx = pPreviousGfx;
+    return run;
+  }
+
+  // Compare flashing the gear red by drawing it again against changing its palette entry. Fails if the screens end up different
+  inline bool BenchmarkGearFlash()
+  {
+    const uint32_t numFlashes = 100;
+    carData.CurrentGear = 3;
+
+    printf("\nGear flashes on the indexed canvas, per color change. The 4 bit canvas takes %u bytes, the 8 bit one %u, the 16 bit one %u\n\n",
+           IndexedCanvas<4>(Panel()).BufferBytes(), IndexedCanvas<8>(Panel()).BufferBytes(), 240 * 240 * 2);
+    printf("  %-18s %10s %10s\n", "", "Pixels", "CPU us");
+
+    const GearFlashRun drawRun = RunGearFlash(numFlashes, false);
+    printf("  %-18s %10.0f %10.1f\n", "Draw", drawRun.Pixels / (2.0 * numFlashes), drawRun.CpuMicros / (2.0 * numFlashes));
+    const GearFlashRun recolorRun = RunGearFlash(numFlashes, true);
+    printf("  %-18s %10.0f %10.1f\n", "Recolor", recolorRun.Pixels / (2.0 * numFlashes), recolorRun.CpuMicros / (2.0 * numFlashes));
+
+    const bool bSame = (drawRun.ScreenHash == recolorRun.ScreenHash);
+    printf("\n  The screens are %s\n", bSame ? "the same" : "different");
+    return bSame;
+  }
+
+  // Compare drawing straight to the display against drawing into the offscreen canvases and rendering in bands. Fails if the screen ever
+  // ends up different
+  inline bool BenchmarkOffscreenCanvas(const std::vector<TimedCanFrame>& frames)
+  {
+    const std::vector<CarData> displayCarData = DisplayCarData(frames);
+    ScanlineRenderer scanlines;
+
+    printf("\nDisplay frames: %zu frames, per frame. The tile canvas sends at most %u tiles, %u pixels. The scanline renderer renders bands of\n"
+           "%d rows into %u bytes of buffers\n\n", displayCarData.size(), NumVisibleTiles, NumVisibleTiles * TileSize * TileSize,
+           ScanlineRenderer::BandRows, uint32_t(DisplayTransferPipeline::NumBuffers * 240 * ScanlineRenderer::BandRows * sizeof(uint16_t)));
+    printf("  %-18s %10s %10s %10s %10s %10s %10s\n", "", "Pixels", "Max pixels", "SPI bytes", "Windows", "SPI us", "CPU us");
+
+    struct
+    {
+      const char* Name;
+      DisplayCanvas* pCanvas;
+      ScanlineRenderer* pScanlines;
+      bool bRedraw;
+    } modes[] =
+    {
+      { "Direct", nullptr, nullptr, false },
+      { "Canvas", new OffscreenCanvas(Panel()), nullptr, false },
+      { "Tiles", new TileCanvas(Panel()), nullptr, false },
+      { "Indexed, 4 bit", new IndexedCanvas<4>(Panel()), nullptr, false },
+      { "Indexed, 8 bit", new IndexedCanvas<8>(Panel()), nullptr, false },
+      { "Scanlines", nullptr, &scanlines, false },
+      { "Direct, redraw", nullptr, nullptr, true },
+      { "Canvas, redraw", new OffscreenCanvas(Panel()), nullptr, true },
+      { "Tiles, redraw", new TileCanvas(Panel()), nullptr, true },
+      { "Indexed, redraw", new IndexedCanvas<4>(Panel()), nullptr, true },
+      { "Scanlines, redraw", nullptr, &scanlines, true },
+    };
+
+    std::vector<DisplayFrameRun> runs;
+    for (const auto& mode : modes)
+    {
+      runs.push_back(RunDisplayFrames(displayCarData, mode.pCanvas, mode.pScanlines, mode.bRedraw));
+      PrintDisplayFrameRun(mode.Name, runs.back(), displayCarData.size());
+      delete mode.pCanvas;
+    }
+
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < displayCarData.size(); i++)
+    {
+      bool bDifferent = false;
+      for (const DisplayFrameRun& run : runs)
+      {
+        bDifferent |= (run.ScreenHashes[i] != runs[0].ScreenHashes[i]);
+      }
+      numDifferent += bDifferent ? 1 : 0;
+    }
+
+    printf("\n  Frames where the screens differ: %zu\n", numDifferent);
+    return BenchmarkGearFlash() && numDifferent == 0;
+  }
+
+  // --------------------------------------------------------
+  // ******** Numeric readout *******************************
+  // --------------------------------------------------------
+
+  struct NumericReadoutRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    uint32_t Updates;
+    uint32_t Chars;                       // Characters drawn
+    uint32_t MaxPixels;                   // Most pixels one update wrote
+    std::vector<uint32_t> ScreenHashes;   // Screen after every update
+  };
+
+  // Show the engine RPM of every frame in the RPM readout, either by erasing every character that's shown and drawing every character of
+  // the new value, like the readout originally did, or with bPerChar by only drawing the characters that changed
+  inline NumericReadoutRun RunNumericReadout(const std::vector<CarData>& displayCarData, const bool bPerChar)
+  {
+    NumericReadoutWidget readout(pDigitFont, RPMReadoutX, RPMReadoutY, 1, RPMReadoutChars, bMirrorText, EngineRPMSignal, WhiteSignal);
+    TurnDisplayOn();
+
+    NumericReadoutRun run = {};
+    Arduino_TFT* pPanel = Panel();
+    const DisplayBusStats before = pPanel->HostBus()->HostStats();
+    NumericReadoutWidget shown = readout;
+    int32_t shownRPM = 0;
+
+    for (size_t i = 0; i < displayCarData.size(); i++)
+    {
+      const int32_t rpm = displayCarData[i].EngineRPM;
+      if (i > 0 && rpm == shownRPM)
+      {
+        continue;
+      }
+
+      const uint64_t startMicros = ThreadCpuMicros();
+      uint32_t numPixels = 0;
+      if (bPerChar)
+      {
+        numPixels = readout.Draw(gfx, rpm, WHITE);
+      }
+      else
+      {
+        // Erase the value that's shown by drawing it again in black, which writes every pixel of it, and then draw the new value with a
+        // widget that never drew anything, which draws every character
+        if (i > 0)
+        {
+          NumericReadoutWidget erase = shown;
+          numPixels += erase.Draw(gfx, shownRPM, BLACK);
+          run.Chars += erase.Stats().Chars - shown.Stats().Chars;
+        }
+        shown = readout;
+        numPixels += shown.Draw(gfx, rpm, WHITE);
+        run.Chars += shown.Stats().Chars;
+      }
+      run.CpuMicros += ThreadCpuMicros() - startMicros;
+
+      run.Updates++;
+      run.MaxPixels = max(run.MaxPixels, numPixels);
+      run.ScreenHashes.push_back(pPanel->HostGramHash());
+      shownRPM = rpm;
+    }
+
+    run.Bus = pPanel->HostBus()->HostStats() - before;
+    run.Chars += readout.Stats().Chars;
+    return run;
+  }
+
+  // Compare redrawing the whole RPM readout whenever the engine RPM changes against only drawing the characters that changed. Fails if
+  // the screens ever end up different
+  inline bool BenchmarkNumericReadout(const std::vector<TimedCanFrame>& frames)
+  {
+    const std::vector<CarData> displayCarData = DisplayCarData(frames);
+
+    const NumericReadoutRun redrawRun = RunNumericReadout(displayCarData, false);
+    const NumericReadoutRun perCharRun = RunNumericReadout(displayCarData, true);
+
+    const double updates = max<uint32_t>(redrawRun.Updates, 1);
+    printf("\nRPM readout: %u of %zu frames change the engine RPM, per change\n\n", redrawRun.Updates, displayCarData.size());
+    printf("  %-18s %10s %10s %10s %10s %10s %10s\n", "", "Chars", "Pixels", "Max pixels", "Windows", "SPI us", "CPU us");
+    for (const auto& named : { std::make_pair("Erase, redraw", &redrawRun), std::make_pair("Per character", &perCharRun) })
+    {
+      const NumericReadoutRun& run = *named.second;
+      printf("  %-18s %10.2f %10.0f %10u %10.1f %10.1f %10.2f\n", named.first, run.Chars / updates, run.Bus.Pixels() / updates, run.MaxPixels,
+             run.Bus.AddressWindows / updates, run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / updates, run.CpuMicros / updates);
+    }
+
+    const bool bSame = (redrawRun.ScreenHashes == perCharRun.ScreenHashes);
+    printf("\n  The screens are %s\n", bSame ? "the same after every change" : "different");
+    return bSame;
+  }
+  // --------------------------------------------------------
+  // ******** RPM history ***********************************
+  // --------------------------------------------------------
+
+  // The engine RPM sampled every RPMHistorySampleMillis of trace time, like SampleRPMHistory() does, and the number of samples taken by
+  // every engine RPM frame
+  inline std::vector<int32_t> SampleRPMHistoryTrace(const std::vector<TimedCanFrame>& frames, std::vector<uint32_t>& numSamplesByFrame)
+  {
+    std::vector<int32_t> samples;
+    uint64_t nextSampleMicros = frames.empty() ? 0 : frames.front().TimeMicros;
+    numSamplesByFrame.clear();
+
+    for (const TimedCanFrame& frame : frames)
+    {
+      for (; nextSampleMicros <= frame.TimeMicros; nextSampleMicros += RPMHistorySampleMillis * 1000)
+      {
+        samples.push_back(g_CurrentCarData.EngineRPM);
+      }
+
+      DecodeCanFrame(frame.Frame);
+      if (frame.Frame.identifier == 0x204 && frame.Frame.data_length_code == 8)
+      {
+        PublishCarData();
+        numSamplesByFrame.push_back(samples.size());
+      }
+    }
+    return samples;
+  }
+
+  enum class RPMHistoryMode
+  {
+    Columns,          // Update(), which only writes the columns of new samples
+    Redraw,           // Clear the strip and draw every column
+    Scanlines,        // Render the screen in bands with the scanline renderer
+  };
+
+  struct RPMHistoryRun
+  {
+    DisplayBusStats Bus;
+    uint64_t CpuMicros;
+    std::vector<uint32_t> ScreenHashes;   // Screen after every frame
+  };
+
+  HistoryStripWidget<RPMHistorySamples>* pBenchmarkHistory = nullptr;
+
+  inline void RenderHistoryRows(uint16_t* pPixels, const BandRect& band)
+  {
+    pBenchmarkHistory->RenderRows(pPixels, band);
+  }
+
+  // Show the samples in the RPM history strip, with one frame for every engine RPM frame of the trace
+  inline RPMHistoryRun RunRPMHistory(const std::vector<int32_t>& samples, const std::vector<uint32_t>& numSamplesByFrame, const RPMHistoryMode mode)
+  {
+    SampleRing<RPMHistorySamples> ring;
+    HistoryStripWidget<RPMHistorySamples> history(&ring, RPMHistoryX, RPMHistoryY, RPMHistoryColumns, RPMHistoryRows, MaxRPM, bMirrorText,
+                                                  ShiftIndicatorColor);
+    pBenchmarkHistory = &history;
+
+    TurnDisplayOn();
+    ScanlineRenderer scanlines;
+    if (mode == RPMHistoryMode::Scanlines)
+    {
+      scanlines.Begin(gfx, xPortGetCoreID());
+    }
+
+    RPMHistoryRun run = {};
+    Arduino_TFT* pPanel = Panel();
+    const DisplayBusStats before = pPanel->HostBus()->HostStats();
+    uint32_t numSamples = 0;
+
+    for (const uint32_t frameSamples : numSamplesByFrame)
+    {
+      for (; numSamples < frameSamples; numSamples++)
+      {
+        ring.Write(samples[numSamples]);
+      }
+
+      const uint64_t startMicros = ThreadCpuMicros();
+      if (mode == RPMHistoryMode::Columns)
+      {
+        history.Update(gfx, carData);
+      }
+      else if (mode == RPMHistoryMode::Redraw)
+      {
+        gfx->fillRect(RPMHistoryX, RPMHistoryY, RPMHistoryColumns, RPMHistoryRows, BLACK);
+        history.Invalidate();
+        history.Update(gfx, carData);
+      }
+      else if (history.BeginRender(carData))
+      {
+        scanlines.RenderFrame(RenderHistoryRows);
+      }
+      run.CpuMicros += ThreadCpuMicros() - startMicros;
+      run.ScreenHashes.push_back(pPanel->HostGramHash());
+    }
+
+    run.Bus = pPanel->HostBus()->HostStats() - before;
+    if (mode == RPMHistoryMode::Scanlines)
+    {
+      scanlines.End();
+    }
+    pBenchmarkHistory = nullptr;
+    return run;
+  }
+
+  // Compare writing only the columns of new samples to the RPM history strip against redrawing the whole strip every frame, and against
+  // rendering it in scanline bands. Fails if the screens ever end up different
+  inline bool BenchmarkRPMHistory(const std::vector<TimedCanFrame>& frames)
+  {
+    std::vector<uint32_t> numSamplesByFrame;
+    const std::vector<int32_t> samples = SampleRPMHistoryTrace(frames, numSamplesByFrame);
+
+    printf("\nRPM history: %zu samples, one every %lu ms, shown in %d columns of %d rows over %zu frames, per sample\n\n", samples.size(),
+           RPMHistorySampleMillis, RPMHistoryColumns, RPMHistoryRows, numSamplesByFrame.size());
+    printf("  %-18s %10s %10s %10s %10s\n", "", "Pixels", "Windows", "SPI us", "CPU us");
+
+    const struct
+    {
+      const char* Name;
+      RPMHistoryMode Mode;
+    } modes[] =
+    {
+      { "Columns", RPMHistoryMode::Columns },
+      { "Redraw", RPMHistoryMode::Redraw },
+      { "Scanlines", RPMHistoryMode::Scanlines },
+    };
+
+    std::vector<RPMHistoryRun> runs;
+    const double numSamples = max<size_t>(samples.size(), 1);
+    for (const auto& mode : modes)
+    {
+      runs.push_back(RunRPMHistory(samples, numSamplesByFrame, mode.Mode));
+      const RPMHistoryRun& run = runs.back();
+      printf("  %-18s %10.0f %10.1f %10.1f %10.2f\n", mode.Name, run.Bus.Pixels() / numSamples, run.Bus.AddressWindows / numSamples,
+             run.Bus.TotalBytes() * 8 * 1000000.0 / 40000000.0 / numSamples, run.CpuMicros / numSamples);
+    }
+
+    size_t numDifferent = 0;
+    for (size_t i = 0; i < numSamplesByFrame.size(); i++)
+    {
+      numDifferent += (runs[1].ScreenHashes[i] != runs[0].ScreenHashes[i] || runs[2].ScreenHashes[i] != runs[0].ScreenHashes[i]) ? 1 : 0;
+    }
+
+    printf("\n  Frames where the screens differ: %zu\n", numDifferent);
+    return numDifferent == 0;
+  }
+
+  // --------------------------------------------------------
+  // ******** Gear font *************************************
+  // --------------------------------------------------------
+
+  // Check that every gear character in the font the firmware uses is byte for byte what it was before the font was subset and mirrored
+  // at compile time, i.e. FreeMonoBold54pt7b after SetupDisplay() called MirrorText() on it at boot
+  inline bool CheckGearFont()
+  {
+    // MirrorText() clears one byte past a glyph whose size is a multiple of 8 pixels, so leave room for that after the last glyph
+    const GFXfont& font = FreeMonoBold54pt7b;
+    std::vector<uint8_t> runtimeBitmaps(FreeMonoBold54pt7bBitmaps, FreeMonoBold54pt7bBitmaps + sizeof(FreeMonoBold54pt7bBitmaps));
+    runtimeBitmaps.push_back(0);
+
+    uint64_t runtimeMicros = 0;
+#ifdef MIRROR_TEXT_FOR_HOLOGRAPHIC_REFLECTION
+    const uint64_t startMicros = ThreadCpuMicros();
+    for (const char* pChar = "PRDN0123456789"; *pChar != 0; pChar++)
+    {
+      const GFXglyph& glyph = font.glyph[uint8_t(*pChar) - font.first];
+      MirrorText(runtimeBitmaps.data(), glyph.bitmapOffset, glyph.width, glyph.height);
+    }
+    runtimeMicros = ThreadCpuMicros() - startMicros;
+#endif
+
+    size_t numBytes = 0;
+    size_t numDifferent = 0;
+    for (const char* pChar = GearTextCharacters; *pChar != 0; pChar++)
+    {
+      const GFXglyph& before = font.glyph[uint8_t(*pChar) - font.first];
+      const GFXglyph& after = pGearFont->glyph[uint8_t(*pChar) - pGearFont->first];
+      if (before.width != after.width || before.height != after.height || before.xAdvance != after.xAdvance ||
+          before.xOffset != after.xOffset || before.yOffset != after.yOffset)
+      {
+        printf("  The size or position of '%c' is different\n", *pChar);
+        numDifferent++;
+        continue;
+      }
+
+      const size_t glyphBytes = GlyphBitmapBytes(before);
+      for (size_t i = 0; i < glyphBytes; i++)
+      {
+        numDifferent += (runtimeBitmaps[before.bitmapOffset + i] != pGearFont->bitmap[after.bitmapOffset + i]) ? 1 : 0;
+      }
+      numBytes += glyphBytes;
+    }
+
+    printf("\nGear font\n\n");
+    printf("  Characters         %10s\n", GearTextCharacters);
+    printf("  Mirrored           %10s\n", (pGearFont->bitmap == GearFont.bitmap) ? "no" : "yes");
+    printf("  Glyph bytes        %10zu\n", numBytes);
+    printf("  MirrorText() time  %10llu us (no longer spent at boot)\n", (unsigned long long)runtimeMicros);
+    printf("\n  Bytes that differ from FreeMonoBold54pt7b as the firmware used to draw it: %zu\n", numDifferent);
+    return numDifferent == 0 && numBytes > 0;
+  }
+}
+
+#endif  // _HOST_BENCHMARKS
@@ -0,0 +1,302 @@
+// Replay recorded CAN traffic into the simulated CAN controller, so a real drive can be reproduced deterministically on the host.
+//
+// Supported trace formats:
+//    candump log files (candump -l):      (1436509052.249713) can0 204#0000000004D20000
+//    candump output, with or without -t:  (1436509052.249713)  can0  204   [8]  00 00 00 00 04 D2 00 00
+//    Vector ASC files:                    0.012345 1  204             Rx   d 8 00 00 00 00 04 D2 00 00
+//
+// Frames are replayed at the recorded rate multiplied by a speed factor, or as fast as the firmware can read them. In the latter case
+// the replay waits for room in the RX queue instead of dropping frames, so it measures the maximum throughput of the read path.
+
+#ifndef _HOST_CAN_TRACE_REPLAY
+#define _HOST_CAN_TRACE_REPLAY
+
+#include <string>
+#include <vector>
+#include "SyntheticDrive.h"
+
+namespace Host
+{
+  // Use as replay speed to replay frames as fast as the firmware reads them
+  const double ReplayAsFastAsPossible = 0.0;
+
+  inline bool ParseHexBytes(const std::vector<std::string>& tokens, size_t first, const size_t count, uint8_t* pData)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      if (first + i >= tokens.size())
+      {
+        return false;
+      }
+      pData[i] = uint8_t(strtoul(tokens[first + i].c_str(), nullptr, 16));
+    }
+    return true;
+  }
+
+  // Parse the "<id>#<data>" part of a candump log line. Returns false for CAN FD frames and anything that isn't a CAN frame
+  inline bool ParseCandumpFrame(const std::string& token, CanFrame& frame)
+  {
+    const size_t hash = token.find('#');
+    if (hash == std::string::npos || hash == 0 || token.compare(hash, 2, "##") == 0)
+    {
+      return false;
+    }
+
+    memset(&frame, 0, sizeof(frame));
+    frame.identifier = strtoul(token.substr(0, hash).c_str(), nullptr, 16);
+    frame.extd = (hash > 3);
+
+    const std::string data = token.substr(hash + 1);
+    if (!data.empty() && (data[0] == 'R' || data[0] == 'r'))
+    {
+      frame.rtr = 1;
+      frame.data_length_code = (data.size() > 1) ? atoi(data.c_str() + 1) : 0;
+      return true;
+    }
+
+    frame.data_length_code = min<size_t>(data.size() / 2, 8);
+    for (int i = 0; i < frame.data_length_code; i++)
+    {
+      frame.data[i] = uint8_t(strtoul(data.substr(i * 2, 2).c_str(), nullptr, 16));
+    }
+    return true;
+  }
+
+  // Parse one line of a trace. Returns false for lines that don't contain a CAN frame, e.g. headers and comments
+  inline bool ParseCanTraceLine(const char* line, TimedCanFrame& timedFrame, bool& bDecimalIDs)
+  {
+    std::vector<std::string> tokens;
+    for (const char* p = line; *p; )
+    {
+      while (*p && isspace((unsigned char)*p))
+      {
+        p++;
+      }
+      const char* start = p;
+      while (*p && !isspace((unsigned char)*p))
+      {
+        p++;
+      }
+      if (p > start)
+      {
+        tokens.emplace_back(start, p);
+      }
+    }
+
+    if (tokens.size() < 3)
+    {
+      return false;
+    }
+
+    // ASC header lines we care about
+    if (tokens[0] == "base")
+    {
+      bDecimalIDs = (tokens[1] == "dec");
+      return false;
+    }
+
+    CanFrame& frame = timedFrame.Frame;
+    memset(&frame, 0, sizeof(frame));
+
+    // candump, starting with an optional "(timestamp)"
+    size_t index = 0;
+    double seconds = 0.0;
+    if (tokens[0][0] == '(')
+    {
+      seconds = atof(tokens[0].c_str() + 1);
+      index = 1;
+    }
+
+    if (index + 1 < tokens.size() && tokens[index + 1].find('#') != std::string::npos)
+    {
+      timedFrame.TimeMicros = uint64_t(seconds * 1000000);
+      return ParseCandumpFrame(tokens[index + 1], frame);
+    }
+
+    if (index + 3 < tokens.size() && tokens[index + 2][0] == '[')
+    {
+      const std::string& id = tokens[index + 1];
+      frame.identifier = strtoul(id.c_str(), nullptr, 16);
+      frame.extd = (id.size() > 3);
+      frame.data_length_code = min(atoi(tokens[index + 2].c_str() + 1), 8);
+      timedFrame.TimeMicros = uint64_t(seconds * 1000000);
+      if (index + 3 < tokens.size() && tokens[index + 3] == "remote")
+      {
+        frame.rtr = 1;
+        return true;
+      }
+      return ParseHexBytes(tokens, index + 3, frame.data_length_code, frame.data);
+    }
+
+    // Vector ASC: <time> <channel> <id>[x] <Rx|Tx> <d|r> <dlc> <data...>
+    if (tokens.size() >= 6 && isdigit((unsigned char)tokens[0][0]) && tokens[0].find('.') != std::string::npos &&
+        (tokens[3] == "Rx" || tokens[3] == "Tx") && (tokens[4] == "d" || tokens[4] == "r"))
+    {
+      const std::string& id = tokens[2];
+      frame.identifier = strtoul(id.c_str(), nullptr, bDecimalIDs ? 10 : 16);
+      frame.extd = (id.back() == 'x' || id.back() == 'X');
+      frame.rtr = (tokens[4] == "r");
+      frame.data_length_code = min(atoi(tokens[5].c_str()), 8);
+      timedFrame.TimeMicros = uint64_t(atof(tokens[0].c_str()) * 1000000);
+      return frame.rtr || ParseHexBytes(tokens, 6, frame.data_length_code, frame.data);
+    }
+
+    return false;
+  }
+
+  // Load a trace. Time stamps are made relative to the first frame
+  inline bool LoadCanTrace(const char* filename, std::vector<TimedCanFrame>& frames)
+  {
+    FILE* pFile = fopen(filename, "r");
+    if (pFile == nullptr)
+    {
+      return false;
+    }
+
+    frames.clear();
+
+    char line[512];
+    bool bDecimalIDs = false;
+    TimedCanFrame timedFrame;
+    while (fgets(line, sizeof(line), pFile))
+    {
+      if (ParseCanTraceLine(line, timedFrame, bDecimalIDs))
+      {
+        frames.push_back(timedFrame);
+      }
+    }
+
+    fclose(pFile);
+
+    if (!frames.empty())
+    {
+      const uint64_t firstMicros = frames.front().TimeMicros;
+      for (TimedCanFrame& frame : frames)
+      {
+        frame.TimeMicros = (frame.TimeMicros >= firstMicros) ? frame.TimeMicros - firstMicros : 0;
+      }
+    }
+
+    return !frames.empty();
+  }
+
+  // Save a trace as a candump log file
+  inline bool SaveCanTrace(const char* filename, const std::vector<TimedCanFrame>& frames)
+  {
+    FILE* pFile = fopen(filename, "w");
+    if (pFile == nullptr)
+    {
+      return false;
+    }
+
+    for (const TimedCanFrame& timedFrame : frames)
+    {
+      const CanFrame& frame = timedFrame.Frame;
+      fprintf(pFile, "(%llu.%06llu) can0 ", (unsigned long long)(timedFrame.TimeMicros / 1000000), (unsigned long long)(timedFrame.TimeMicros % 1000000));
+      fprintf(pFile, frame.extd ? "%08X#" : "%03X#", frame.identifier);
+      if (frame.rtr)
+      {
+        fprintf(pFile, "R");
+      }
+      else
+      {
+        for (int i = 0; i < frame.data_length_code; i++)
+        {
+          fprintf(pFile, "%02X", frame.data[i]);
+        }
+      }
+      fprintf(pFile, "\n");
+    }
+
+    fclose(pFile);
+    return true;
+  }
+
+  inline uint64_t CanTraceDurationMicros(const std::vector<TimedCanFrame>& frames)
+  {
+    return frames.empty() ? 0 : frames.back().TimeMicros;
+  }
+
+  struct ReplayStats
+  {
+    uint64_t FramesReplayed;
+    uint64_t RealMicros;      // Real time from the first to the last replayed frame
+
+    double FramesPerSecond() const { return (RealMicros > 0) ? FramesReplayed * 1000000.0 / RealMicros : 0.0; }
+  };
+
+  // Replays a trace on its own thread
+  class CanTraceReplay
+  {
+    public:
+      ~CanTraceReplay()
+      {
+        Stop();
+      }
+
+      // Start replaying. With bWaitForDriver the replay starts when the firmware has started the CAN driver, like a car that is already running
+      void Start(const std::vector<TimedCanFrame>& frames, const double speed, const bool bWaitForDriver = true)
+      {
+        Stop();
+        m_bStop = false;
+        m_bDone = false;
+        m_stats = { 0, 0 };
+        m_thread = std::thread(&CanTraceReplay::Run, this, std::cref(frames), speed, bWaitForDriver);
+      }
+
+      void Stop()
+      {
+        m_bStop = true;
+        if (m_thread.joinable())
+        {
+          m_thread.join();
+        }
+      }
+
+      bool IsDone() const { return m_bDone; }
+
+      ReplayStats Stats() const { return m_stats; }
+
+    private:
+      void Run(const std::vector<TimedCanFrame>& frames, const double speed, const bool bWaitForDriver)
+      {
+        while (bWaitForDriver && !ESP32Can.HostIsStarted() && !m_bStop)
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        const bool bAsFastAsPossible = (speed <= ReplayAsFastAsPossible);
+        const auto startTime = std::chrono::steady_clock::now();
+
+        for (const TimedCanFrame& frame : frames)
+        {
+          if (m_bStop)
+          {
+            break;
+          }
+
+          if (!bAsFastAsPossible)
+          {
+            const auto dueTime = startTime + std::chrono::microseconds(uint64_t(frame.TimeMicros / speed));
+            if (std::chrono::steady_clock::now() < dueTime)
+            {
+              std::this_thread::sleep_until(dueTime);
+            }
+          }
+
+          ESP32Can.HostReceiveFrame(frame.Frame, bAsFastAsPossible);
+          m_stats.FramesReplayed++;
+        }
+
+        m_stats.RealMicros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+        m_bDone = true;
+      }
+
+      std::thread m_thread;
+      std::atomic<bool> m_bStop { false };
+      std::atomic<bool> m_bDone { false };
+      ReplayStats m_stats = { 0, 0 };
+  };
+}
+
+#endif  // _HOST_CAN_TRACE_REPLAY
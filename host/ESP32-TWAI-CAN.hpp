@@ -0,0 +1,252 @@
+// Host-side stand-in for the ESP32-TWAI-CAN library. Instead of a CAN controller there is an in-memory RX queue, which is filled by
+// calling ESP32Can.HostReceiveFrame() from another thread, e.g. a synthetic drive or a recorded trace. The queue has the same length as the
+// RX queue passed to ESP32Can.begin(), and frames that arrive while it's full are dropped and counted, just like the TWAI driver does.
+
+#ifndef _HOST_ESP32_TWAI_CAN
+#define _HOST_ESP32_TWAI_CAN
+
+#include <deque>
+
+typedef enum
+{
+  GPIO_NUM_NC = -1,
+} gpio_num_t;
+
+typedef enum
+{
+  TWAI_MODE_NORMAL,
+  TWAI_MODE_NO_ACK,
+  TWAI_MODE_LISTEN_ONLY,
+} twai_mode_t;
+
+typedef enum
+{
+  TWAI_SPEED_100KBPS = 100,
+  TWAI_SPEED_125KBPS = 125,
+  TWAI_SPEED_250KBPS = 250,
+  TWAI_SPEED_500KBPS = 500,
+  TWAI_SPEED_800KBPS = 800,
+  TWAI_SPEED_1000KBPS = 1000,
+} TwaiSpeed;
+
+typedef struct
+{
+  twai_mode_t mode;
+  gpio_num_t tx_io;
+  gpio_num_t rx_io;
+  gpio_num_t clkout_io;
+  gpio_num_t bus_off_io;
+  uint32_t tx_queue_len;
+  uint32_t rx_queue_len;
+  uint32_t alerts_enabled;
+  uint32_t clkout_divider;
+  int intr_flags;
+} twai_general_config_t;
+
+typedef struct
+{
+  uint32_t acceptance_code;
+  uint32_t acceptance_mask;
+  bool single_filter;
+} twai_filter_config_t;
+
+typedef struct
+{
+  uint32_t brp;
+  uint8_t tseg_1;
+  uint8_t tseg_2;
+  uint8_t sjw;
+  bool triple_sampling;
+} twai_timing_config_t;
+
+#define TWAI_GENERAL_CONFIG_DEFAULT(tx_io_num, rx_io_num, op_mode) { op_mode, tx_io_num, rx_io_num, GPIO_NUM_NC, GPIO_NUM_NC, 5, 5, 0, 0, 0 }
+#define TWAI_FILTER_CONFIG_ACCEPT_ALL() { 0, 0xFFFFFFFF, true }
+
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      uint32_t extd: 1;
+      uint32_t rtr: 1;
+      uint32_t ss: 1;
+      uint32_t self: 1;
+      uint32_t dlc_non_comp: 1;
+      uint32_t reserved: 27;
+    };
+    uint32_t flags;
+  };
+  uint32_t identifier;
+  uint8_t data_length_code;
+  uint8_t data[8];
+} twai_message_t;
+
+typedef twai_message_t CanFrame;
+
+namespace Host
+{
+  // Counters for the simulated CAN controller
+  struct CanBusStats
+  {
+    uint64_t FramesOnBus;     // Frames offered to the controller
+    uint64_t FramesFiltered;  // Frames rejected by the acceptance filter
+    uint64_t FramesQueued;    // Frames that made it into the RX queue
+    uint64_t FramesDropped;   // Frames lost because the RX queue was full
+    uint64_t FramesRead;      // Frames handed to the firmware by readFrame()
+    uint32_t MaxQueueDepth;   // Highest number of frames waiting in the RX queue since the driver was started
+  };
+
+  // Hardware acceptance filter, see "Acceptance Filter" in the ESP-IDF TWAI documentation. Data bytes are not compared
+  inline bool TwaiFilterAccepts(const twai_filter_config_t& filter, const CanFrame& frame)
+  {
+    const uint32_t code = filter.acceptance_code;
+    const uint32_t mask = filter.acceptance_mask;
+
+    if (frame.extd)
+    {
+      // Dual filter mode only compares the 16 most significant bits of an extended ID
+      const uint32_t bits = (frame.identifier << 3) | (frame.rtr << 2);
+      const uint32_t highBits = (frame.identifier >> 13) & 0xFFFF;
+      return filter.single_filter ? (((bits ^ code) & ~mask & 0xFFFFFFFC) == 0)
+                                  : (((highBits ^ (code >> 16)) & ~(mask >> 16) & 0xFFFF) == 0 ||
+                                     ((highBits ^ code) & ~mask & 0xFFFF) == 0);
+    }
+
+    const uint32_t bits = (frame.identifier << 21) | (frame.rtr << 20);
+    return filter.single_filter ? (((bits ^ code) & ~mask & 0xFFF00000) == 0)
+                                : (((bits ^ code) & ~mask & 0xFFF00000) == 0 ||
+                                   (((bits >> 16) ^ code) & ~mask & 0x0000FFF0) == 0);
+  }
+}
+
+class TwaiCAN
+{
+  public:
+    bool begin(TwaiSpeed twaiSpeed = TWAI_SPEED_500KBPS, int8_t txPin = -1, int8_t rxPin = -1, uint16_t txQueue = 0xFFFF, uint16_t rxQueue = 0xFFFF,
+               twai_filter_config_t* fConfig = nullptr, twai_general_config_t* gConfig = nullptr, twai_timing_config_t* tConfig = nullptr)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_rxQueueLength = (rxQueue == 0xFFFF) ? 5 : rxQueue;
+      m_filter = fConfig ? *fConfig : twai_filter_config_t TWAI_FILTER_CONFIG_ACCEPT_ALL();
+      m_stats.MaxQueueDepth = 0;
+      m_bStarted = true;
+      m_changed.notify_all();
+      return true;
+    }
+
+    bool end()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_bStarted = false;
+      m_rxQueue.clear();
+      m_changed.notify_all();
+      return true;
+    }
+
+    bool readFrame(CanFrame& frame, uint32_t timeout = 1000)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (!Host::WaitFor(lock, m_changed, pdMS_TO_TICKS(timeout), [this]() { return !m_rxQueue.empty(); }))
+      {
+        // The real driver leaves the frame untouched. Clearing it keeps host runs deterministic
+        memset(&frame, 0, sizeof(frame));
+        return false;
+      }
+
+      frame = m_rxQueue.front();
+      m_rxQueue.pop_front();
+      m_stats.FramesRead++;
+      m_changed.notify_all();
+      return true;
+    }
+
+    bool readFrame(CanFrame* frame, uint32_t timeout = 1000)
+    {
+      return readFrame(*frame, timeout);
+    }
+
+    bool writeFrame(const CanFrame& frame, uint32_t timeout = 1)
+    {
+      return m_bStarted;
+    }
+
+    bool writeFrame(const CanFrame* frame, uint32_t timeout = 1)
+    {
+      return writeFrame(*frame, timeout);
+    }
+
+    uint32_t inRxQueue()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_rxQueue.size();
+    }
+
+    uint32_t inTxQueue()
+    {
+      return 0;
+    }
+
+    // ******** Host only **********************************
+
+    bool HostIsStarted()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_bStarted;
+    }
+
+    // Offer a frame to the controller as if it was received from the bus. When bWaitForSpace is true the call blocks until there's room in
+    // the RX queue instead of dropping the frame, which is useful to measure how fast the firmware can consume frames
+    bool HostReceiveFrame(const CanFrame& frame, const bool bWaitForSpace)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (!m_bStarted)
+      {
+        return false;
+      }
+
+      m_stats.FramesOnBus++;
+
+      if (!Host::TwaiFilterAccepts(m_filter, frame))
+      {
+        m_stats.FramesFiltered++;
+        return false;
+      }
+
+      if (bWaitForSpace)
+      {
+        m_changed.wait(lock, [this]() { return !m_bStarted || m_rxQueue.size() < m_rxQueueLength; });
+      }
+
+      if (!m_bStarted || m_rxQueue.size() >= m_rxQueueLength)
+      {
+        m_stats.FramesDropped++;
+        return false;
+      }
+
+      m_rxQueue.push_back(frame);
+      m_stats.FramesQueued++;
+      m_stats.MaxQueueDepth = max(m_stats.MaxQueueDepth, uint32_t(m_rxQueue.size()));
+      m_changed.notify_all();
+      return true;
+    }
+
+    Host::CanBusStats HostStats()
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_stats;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::deque<CanFrame> m_rxQueue;
+    uint32_t m_rxQueueLength = 5;
+    twai_filter_config_t m_filter = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    bool m_bStarted = false;
+    Host::CanBusStats m_stats = { 0 };
+};
+
+TwaiCAN ESP32Can;
+
+#endif  // _HOST_ESP32_TWAI_CAN
@@ -0,0 +1,225 @@
+// Generates the fonts the firmware draws text with, as subsets of FreeMonoBold54pt7b:
+//
+//    ../GearFont.h     Only the glyphs of the characters in GearTextCharacters
+//    ../DigitFont.h    Only the glyphs of the characters in DigitTextCharacters, scaled down by DigitFontScale
+//
+// The glyph table still covers every character from the first to the last of them, so it's a regular GFXfont that works with gfx->printf()
+// and the sprite cache, but the characters in between that are never shown get empty glyphs without any bitmap data.
+//
+// A scaled down glyph pixel is set when at least half of the pixels it covers are set. The pixels are aligned to the cursor, not to the
+// glyph, so all characters of a scaled down font still line up.
+//
+// Run "make gear-font" after changing GearTextCharacters, and "make digit-font" after changing DigitTextCharacters or DigitFontScale.
+
+#ifndef _HOST_FONT_SUBSET_GENERATOR
+#define _HOST_FONT_SUBSET_GENERATOR
+
+#include "../FreeMonoBold54pt7b.h"
+
+namespace Host
+{
+  inline size_t GlyphBitmapBytes(const GFXglyph& glyph)
+  {
+    return (uint32_t(glyph.width) * glyph.height + 7) / 8;
+  }
+
+  // The bytes a font takes in flash: the bitmaps, the glyph table and the GFXfont itself
+  inline size_t FontBytes(const size_t numBitmapBytes, const size_t numGlyphs)
+  {
+    return numBitmapBytes + numGlyphs * sizeof(GFXglyph) + sizeof(GFXfont);
+  }
+
+  struct FontSubset
+  {
+    std::vector<uint8_t> Bitmaps;
+    std::vector<GFXglyph> Glyphs;
+    uint16_t First;
+    uint16_t Last;
+    uint8_t YAdvance;
+  };
+
+  // Rounds towards minus infinity, unlike /
+  inline int32_t FloorDivide(const int32_t a, const int32_t b)
+  {
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+  }
+
+  // Glyph of the font scaled down by scale, with its bitmap appended to bitmaps
+  inline GFXglyph ScaleGlyph(const GFXfont& font, const GFXglyph& glyph, const int32_t scale, std::vector<uint8_t>& bitmaps)
+  {
+    // The scaled down pixels the glyph touches, relative to the cursor
+    const int32_t left = FloorDivide(glyph.xOffset, scale);
+    const int32_t top = FloorDivide(glyph.yOffset, scale);
+    const int32_t right = FloorDivide(glyph.xOffset + glyph.width + scale - 1, scale);
+    const int32_t bottom = FloorDivide(glyph.yOffset + glyph.height + scale - 1, scale);
+
+    std::vector<bool> pixels;
+    int32_t minX = right, minY = bottom, maxX = left - 1, maxY = top - 1;
+    for (int32_t y = top; y < bottom; y++)
+    {
+      for (int32_t x = left; x < right; x++)
+      {
+        int32_t numSet = 0;
+        for (int32_t j = y * scale; j < (y + 1) * scale; j++)
+        {
+          for (int32_t i = x * scale; i < (x + 1) * scale; i++)
+          {
+            numSet += IsGlyphPixelSet(font, glyph, i, j) ? 1 : 0;
+          }
+        }
+
+        const bool bSet = (2 * numSet >= scale * scale);
+        pixels.push_back(bSet);
+        minX = bSet ? min(minX, x) : minX;
+        minY = bSet ? min(minY, y) : minY;
+        maxX = bSet ? max(maxX, x) : maxX;
+        maxY = bSet ? max(maxY, y) : maxY;
+      }
+    }
+
+    const uint8_t xAdvance = uint8_t((glyph.xAdvance + scale / 2) / scale);
+    if (maxX < minX)
+    {
+      return { 0, 0, 0, xAdvance, 0, 0 };
+    }
+
+    // Only keep the rows and columns with set pixels
+    const GFXglyph scaled = { uint16_t(bitmaps.size()), uint8_t(maxX - minX + 1), uint8_t(maxY - minY + 1), xAdvance, int8_t(minX), int8_t(minY) };
+    bitmaps.resize(bitmaps.size() + GlyphBitmapBytes(scaled), 0);
+
+    uint32_t pixel = 0;
+    for (int32_t y = minY; y <= maxY; y++)
+    {
+      for (int32_t x = minX; x <= maxX; x++, pixel++)
+      {
+        if (pixels[(y - top) * (right - left) + (x - left)])
+        {
+          bitmaps[scaled.bitmapOffset + pixel / 8] |= 0x80 >> (pixel % 8);
+        }
+      }
+    }
+    return scaled;
+  }
+
+  // The glyphs of the characters in pChars, scaled down by scale, and empty glyphs for the other characters in between
+  inline bool SubsetFont(const GFXfont& font, const char* pChars, const int32_t scale, FontSubset& subset)
+  {
+    subset.First = 0xFF;
+    subset.Last = 0;
+    for (const char* pChar = pChars; *pChar != 0; pChar++)
+    {
+      if (uint8_t(*pChar) < font.first || uint8_t(*pChar) > font.last)
+      {
+        printf("FreeMonoBold54pt7b has no '%c'\n", *pChar);
+        return false;
+      }
+      subset.First = min<uint16_t>(subset.First, uint8_t(*pChar));
+      subset.Last = max<uint16_t>(subset.Last, uint8_t(*pChar));
+    }
+
+    if (subset.First > subset.Last)
+    {
+      printf("No characters to generate a font for\n");
+      return false;
+    }
+
+    // Copy the glyphs in use, in character order, and leave the others empty
+    subset.YAdvance = uint8_t((font.yAdvance + scale / 2) / scale);
+    for (uint16_t c = subset.First; c <= subset.Last; c++)
+    {
+      const GFXglyph& glyph = font.glyph[c - font.first];
+      if (strchr(pChars, c) == nullptr)
+      {
+        subset.Glyphs.push_back({ 0, 0, 0, uint8_t((glyph.xAdvance + scale / 2) / scale), 0, 0 });
+      }
+      else if (scale == 1)
+      {
+        subset.Glyphs.push_back({ uint16_t(subset.Bitmaps.size()), glyph.width, glyph.height, glyph.xAdvance, glyph.xOffset, glyph.yOffset });
+        subset.Bitmaps.insert(subset.Bitmaps.end(), font.bitmap + glyph.bitmapOffset, font.bitmap + glyph.bitmapOffset + GlyphBitmapBytes(glyph));
+      }
+      else
+      {
+        subset.Glyphs.push_back(ScaleGlyph(font, glyph, scale, subset.Bitmaps));
+      }
+    }
+    return true;
+  }
+
+  // Write the font as <name>Bitmaps, <name>Glyphs and <name>, with pDescription as the first line of the file
+  inline bool WriteFont(const char* filename, const char* name, const char* pGuard, const char* pDescription, const char* pMakeTarget,
+                        const FontSubset& subset)
+  {
+    FILE* pFile = fopen(filename, "w");
+    if (pFile == nullptr)
+    {
+      printf("Failed to create %s\n", filename);
+      return false;
+    }
+
+    const GFXfont& font = FreeMonoBold54pt7b;
+    const size_t originalBytes = FontBytes(sizeof(FreeMonoBold54pt7bBitmaps), font.last - font.first + 1);
+    const size_t subsetBytes = FontBytes(subset.Bitmaps.size(), subset.Glyphs.size());
+
+    fprintf(pFile, "// %s. Generated by \"make %s\" in the host folder, see\n"
+                   "// host/FontSubsetGenerator.h\n"
+                   "//\n"
+                   "// The characters from '%c' to '%c' that aren't listed have empty glyphs, so this is a regular GFXfont\n\n"
+                   "#ifndef %s\n"
+                   "#define %s\n\n"
+                   "#ifndef PROGMEM\n"
+                   "#define PROGMEM\n"
+                   "#endif\n\n",
+            pDescription, pMakeTarget, char(subset.First), char(subset.Last), pGuard, pGuard);
+
+    fprintf(pFile, "constexpr uint8_t %sBitmaps[] PROGMEM = {", name);
+    for (size_t i = 0; i < subset.Bitmaps.size(); i++)
+    {
+      fprintf(pFile, "%s0x%02X%s", (i % 12 == 0) ? "\n  " : " ", subset.Bitmaps[i], (i + 1 < subset.Bitmaps.size()) ? "," : "");
+    }
+    fprintf(pFile, " };\n\n");
+
+    fprintf(pFile, "constexpr GFXglyph %sGlyphs[] PROGMEM = {\n", name);
+    for (size_t i = 0; i < subset.Glyphs.size(); i++)
+    {
+      const GFXglyph& glyph = subset.Glyphs[i];
+      fprintf(pFile, "  { %5u, %3u, %3u, %3u, %4d, %4d }%s   // 0x%02X '%c'\n", glyph.bitmapOffset, glyph.width, glyph.height, glyph.xAdvance,
+              glyph.xOffset, glyph.yOffset, (i + 1 < subset.Glyphs.size()) ? "," : " };", unsigned(subset.First + i), char(subset.First + i));
+    }
+
+    fprintf(pFile, "\nconstexpr GFXfont %s PROGMEM = {\n"
+                   "  (uint8_t  *)%sBitmaps,\n"
+                   "  (GFXglyph *)%sGlyphs,\n"
+                   "  0x%02X, 0x%02X, %u };\n\n"
+                   "// Approx. %zu bytes, FreeMonoBold54pt7b is approx. %zu bytes\n\n"
+                   "#endif  // %s\n",
+            name, name, name, subset.First, subset.Last, subset.YAdvance, subsetBytes, originalBytes, pGuard);
+
+    fclose(pFile);
+
+    printf("Wrote %s\n\n", filename);
+    printf("  %-20s %10s %10s %10s\n", "", "Glyphs", "Bitmap", "Total");
+    printf("  %-20s %10u %10zu %10zu\n", "FreeMonoBold54pt7b", unsigned(font.last - font.first + 1), sizeof(FreeMonoBold54pt7bBitmaps), originalBytes);
+    printf("  %-20s %10zu %10zu %10zu\n", name, subset.Glyphs.size(), subset.Bitmaps.size(), subsetBytes);
+    printf("\n  Flash saved %zu bytes. The font is const, so it takes no RAM either way\n", originalBytes - subsetBytes);
+    return true;
+  }
+
+  inline bool GenerateGearFont(const char* filename)
+  {
+    FontSubset subset;
+    const std::string description = std::string("FreeMonoBold54pt7b with only the glyphs of \"") + GearTextCharacters + "\"";
+    return SubsetFont(FreeMonoBold54pt7b, GearTextCharacters, 1, subset) &&
+           WriteFont(filename, "GearFont", "_GEAR_FONT", description.c_str(), "gear-font", subset);
+  }
+
+  inline bool GenerateDigitFont(const char* filename)
+  {
+    FontSubset subset;
+    const std::string description = "FreeMonoBold54pt7b scaled down by " + std::to_string(DigitFontScale) + ", with only the glyphs of \"" +
+                                    DigitTextCharacters + "\"";
+    return SubsetFont(FreeMonoBold54pt7b, DigitTextCharacters, DigitFontScale, subset) &&
+           WriteFont(filename, "DigitFont", "_DIGIT_FONT", description.c_str(), "digit-font", subset);
+  }
+}
+
+#endif  // _HOST_FONT_SUBSET_GENERATOR
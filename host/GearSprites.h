@@ -0,0 +1,205 @@
+// Pre-rendered RGB565 images ("sprites") of the gear characters. Drawing a character with gfx->printf() sets its pixels one small
+// rectangle at a time, and changing the gear means doing that twice: once in black to erase the old gear and once for the new one. A
+// sprite covers the old and the new character at once, background included, so it's sent to the display as a single block of pixels.
+//
+// The sprites of every character in every color are rendered once at startup into PSRAM. Without PSRAM, a character is rendered into a
+// buffer in internal RAM each time it's drawn, which still sends it to the display in one go.
+//
+// The firmware draws the gear with DrawGlyphTransition() now, so this is only kept for --bench-gear to compare against.
+
+#ifndef _HOST_GEAR_SPRITES
+#define _HOST_GEAR_SPRITES
+
+struct SpriteRect
+{
+  int16_t X;
+  int16_t Y;
+  int16_t W;
+  int16_t H;
+};
+
+// The smallest rectangle that contains both a and b
+inline SpriteRect UnionRect(const SpriteRect& a, const SpriteRect& b)
+{
+  const int16_t x = min(a.X, b.X);
+  const int16_t y = min(a.Y, b.Y);
+  return { x, y, int16_t(max(a.X + a.W, b.X + b.W) - x), int16_t(max(a.Y + a.H, b.Y + b.H) - y) };
+}
+
+class GearSpriteCache
+{
+  public:
+    static constexpr int32_t MaxChars = 16;
+    static constexpr int32_t MaxColors = 4;
+
+    // Render the characters in pChars in every color, as they would be drawn by gfx->printf() with the given font, text size and cursor
+    bool Begin(const GFXfont* pFont, const int16_t cursorX, const int16_t cursorY, const uint8_t textSize, const char* pChars, const uint16_t* pColors,
+               const int32_t numColors)
+    {
+      m_pFont = pFont;
+      m_cursorX = cursorX;
+      m_cursorY = cursorY;
+      m_textSize = textSize;
+      m_numChars = min(int32_t(strlen(pChars)), MaxChars);
+      m_numColors = min(numColors, MaxColors);
+      memcpy(m_chars, pChars, m_numChars);
+      memcpy(m_colors, pColors, m_numColors * sizeof(uint16_t));
+
+      // All sprites have the same size, so any character can replace any other
+      m_bounds = CharRect(m_chars[0]);
+      for (int32_t i = 1; i < m_numChars; i++)
+      {
+        m_bounds = UnionRect(m_bounds, CharRect(m_chars[i]));
+      }
+
+      const uint32_t spritePixels = uint32_t(m_bounds.W) * m_bounds.H;
+      m_pScratch = (uint16_t*)heap_caps_malloc(spritePixels * sizeof(uint16_t), MALLOC_CAP_DMA);
+      if (m_pScratch == nullptr)
+      {
+        DebugPrintln("GearSpriteCache: Failed to allocate scratch buffer");
+        return false;
+      }
+
+      m_pSprites = psramFound() ? (uint16_t*)ps_malloc(spritePixels * m_numChars * m_numColors * sizeof(uint16_t)) : nullptr;
+      if (m_pSprites)
+      {
+        for (int32_t i = 0; i < m_numChars; i++)
+        {
+          for (int32_t j = 0; j < m_numColors; j++)
+          {
+            Render(m_pSprites + (i * m_numColors + j) * spritePixels, m_bounds, m_chars[i], m_colors[j]);
+          }
+        }
+      }
+
+      DebugPrintf("GearSpriteCache: %dx%d pixel sprites, %s\n", m_bounds.W, m_bounds.H, m_pSprites ? "cached in PSRAM" : "rendered when drawn");
+      return true;
+    }
+
+    void End()
+    {
+      heap_caps_free(m_pScratch);
+      free(m_pSprites);
+      m_pScratch = nullptr;
+      m_pSprites = nullptr;
+    }
+
+    // The part of the screen the character itself covers
+    SpriteRect CharRect(const char c) const
+    {
+      const GFXglyph& glyph = m_pFont->glyph[uint8_t(c) - m_pFont->first];
+      return { int16_t(m_cursorX + glyph.xOffset * m_textSize), int16_t(m_cursorY + glyph.yOffset * m_textSize), int16_t(glyph.width * m_textSize),
+               int16_t(glyph.height * m_textSize) };
+    }
+
+    // The part of the screen any of the sprites can cover
+    inline const SpriteRect& Bounds() const { return m_bounds; }
+
+    // False when there's no PSRAM, and every sprite is rendered when it's drawn
+    inline bool IsCached() const { return m_pSprites != nullptr; }
+
+    // Draw the part of the sprite of a character that falls inside rect, which has to be inside Bounds(). Everything in rect that isn't
+    // part of the character is drawn black
+    void Draw(Arduino_GFX* pGfx, const SpriteRect& rect, const char c, const uint16_t color)
+    {
+      const uint16_t* pSprite = FindSprite(c, color);
+      const uint16_t* pPixels = m_pScratch;
+
+      if (pSprite && rect.X == m_bounds.X && rect.Y == m_bounds.Y && rect.W == m_bounds.W && rect.H == m_bounds.H)
+      {
+        pPixels = pSprite;
+      }
+      else if (pSprite)
+      {
+        for (int16_t y = 0; y < rect.H; y++)
+        {
+          memcpy(m_pScratch + y * rect.W, pSprite + (rect.Y - m_bounds.Y + y) * m_bounds.W + (rect.X - m_bounds.X), rect.W * sizeof(uint16_t));
+        }
+      }
+      else
+      {
+        Render(m_pScratch, rect, c, color);
+      }
+
+      pGfx->draw16bitRGBBitmap(rect.X, rect.Y, (uint16_t*)pPixels, rect.W, rect.H);
+    }
+
+  private:
+    const uint16_t* FindSprite(const char c, const uint16_t color) const
+    {
+      if (m_pSprites == nullptr)
+      {
+        return nullptr;
+      }
+
+      for (int32_t i = 0; i < m_numChars; i++)
+      {
+        for (int32_t j = 0; j < m_numColors; j++)
+        {
+          if (m_chars[i] == c && m_colors[j] == color)
+          {
+            return m_pSprites + (i * m_numColors + j) * uint32_t(m_bounds.W) * m_bounds.H;
+          }
+        }
+      }
+
+      return nullptr;
+    }
+
+    // Render the part of a character that falls inside rect, the same way the Adafruit GFX text code draws a glyph
+    void Render(uint16_t* pPixels, const SpriteRect& rect, const char c, const uint16_t color) const
+    {
+      for (int32_t i = 0; i < int32_t(rect.W) * rect.H; i++)
+      {
+        pPixels[i] = BLACK;
+      }
+
+      const GFXglyph& glyph = m_pFont->glyph[uint8_t(c) - m_pFont->first];
+      const uint8_t* pBitmap = m_pFont->bitmap + glyph.bitmapOffset;
+      const SpriteRect charRect = CharRect(c);
+      uint8_t bits = 0;
+      uint32_t bit = 0;
+
+      for (int16_t yy = 0; yy < glyph.height; yy++)
+      {
+        for (int16_t xx = 0; xx < glyph.width; xx++, bit++)
+        {
+          if ((bit & 7) == 0)
+          {
+            bits = pBitmap[bit / 8];
+          }
+
+          if (bits & 0x80)
+          {
+            // Each font pixel is a textSize x textSize block on the screen
+            for (int16_t y = charRect.Y + yy * m_textSize; y < charRect.Y + (yy + 1) * m_textSize; y++)
+            {
+              for (int16_t x = charRect.X + xx * m_textSize; x < charRect.X + (xx + 1) * m_textSize; x++)
+              {
+                if (x >= rect.X && x < rect.X + rect.W && y >= rect.Y && y < rect.Y + rect.H)
+                {
+                  pPixels[(y - rect.Y) * rect.W + (x - rect.X)] = color;
+                }
+              }
+            }
+          }
+
+          bits <<= 1;
+        }
+      }
+    }
+
+    const GFXfont* m_pFont = nullptr;
+    int16_t m_cursorX = 0;
+    int16_t m_cursorY = 0;
+    uint8_t m_textSize = 1;
+    char m_chars[MaxChars];
+    uint16_t m_colors[MaxColors];
+    int32_t m_numChars = 0;
+    int32_t m_numColors = 0;
+    SpriteRect m_bounds = { 0, 0, 0, 0 };
+    uint16_t* m_pSprites = nullptr;   // m_numChars x m_numColors sprites of m_bounds size
+    uint16_t* m_pScratch = nullptr;
+};
+
+#endif  // _HOST_GEAR_SPRITES
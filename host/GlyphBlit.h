@@ -0,0 +1,68 @@
+// Draw one glyph of a GFXfont straight from the font's tables. gfx->printf("%c", c) formats a string with vsnprintf(), and hands every
+// character to Print::write() and then to drawChar(), which looks the glyph up again and draws every set pixel as its own rectangle.
+// DrawGlyph() skips all of that: it takes the glyph, the cursor, the text size and the color, and sends every horizontal span of set
+// pixels as one filled rectangle. The pixels that end up set are the same as with gfx->printf(), and the pixels that aren't set are left
+// alone, like gfx->printf() does without a background color.
+//
+// The firmware draws the gear and the readouts with DrawGlyphTransition(), which writes the same spans when a character appears on a
+// blank screen, so this is only kept for --bench-gear to compare against.
+
+#ifndef _HOST_GLYPH_BLIT
+#define _HOST_GLYPH_BLIT
+
+// Draw glyph glyphIndex of the font, which is character font.first + glyphIndex, with the cursor at cursorX,cursorY. Returns the number of
+// pixels written
+inline uint32_t DrawGlyph(Arduino_GFX* pGfx, const GFXfont& font, const uint16_t glyphIndex, const int16_t cursorX, const int16_t cursorY,
+                          const uint8_t textSize, const uint16_t color)
+{
+  const GFXglyph& glyph = font.glyph[glyphIndex];
+  const uint8_t* pBitmap = font.bitmap + glyph.bitmapOffset;
+  uint8_t bits = 0;
+  uint8_t mask = 0;
+  uint32_t numPixels = 0;
+
+  // The rows of a glyph aren't padded to whole bytes, so the bits simply carry on from one row to the next
+  pGfx->startWrite();
+  for (int16_t y = 0; y < glyph.height; y++)
+  {
+    int16_t spanStart = -1;
+    for (int16_t x = 0; x <= glyph.width; x++)
+    {
+      bool bSet = false;
+      if (x < glyph.width)
+      {
+        if (mask == 0)
+        {
+          bits = *pBitmap++;
+          mask = 0x80;
+        }
+        bSet = (bits & mask) != 0;
+        mask >>= 1;
+      }
+
+      if (bSet && spanStart < 0)
+      {
+        spanStart = x;
+      }
+      else if (!bSet && spanStart >= 0)
+      {
+        pGfx->writeFillRect(cursorX + (glyph.xOffset + spanStart) * textSize, cursorY + (glyph.yOffset + y) * textSize,
+                            (x - spanStart) * textSize, textSize, color);
+        numPixels += uint32_t(x - spanStart) * textSize * textSize;
+        spanStart = -1;
+      }
+    }
+  }
+  pGfx->endWrite();
+
+  return numPixels;
+}
+
+// Draw character c of the font, which has to be between font.first and font.last
+inline uint32_t DrawChar(Arduino_GFX* pGfx, const GFXfont& font, const char c, const int16_t cursorX, const int16_t cursorY,
+                         const uint8_t textSize, const uint16_t color)
+{
+  return DrawGlyph(pGfx, font, uint16_t(uint8_t(c) - font.first), cursorX, cursorY, textSize, color);
+}
+
+#endif  // _HOST_GLYPH_BLIT
@@ -0,0 +1,135 @@
+// Run-length encoded glyphs of a GFXfont. The glyphs of a large font are mostly long runs of set or unset pixels, so instead of a bitmap
+// every glyph is stored as the lengths of those runs. They alternate between unset and set pixels, starting with unset ones, in the same
+// order as the bitmap: row by row, from the top. A run longer than 255 pixels is split in two by a zero length run of the other kind, and
+// the unset pixels at the end of a glyph are left out.
+//
+// DrawGlyphRuns() sends every set run to the display as one filled rectangle per row it covers, so a character takes a few hundred
+// rectangles instead of one per pixel like gfx->printf() draws it. The runs are encoded at compile time from the font's bitmaps.
+//
+// The firmware draws the gear with DrawGlyphTransition() now, so this is only kept for --bench-gear to compare against.
+
+#ifndef _HOST_GLYPH_RUNS
+#define _HOST_GLYPH_RUNS
+
+template <size_t NumRuns, size_t NumGlyphs>
+struct FontRuns
+{
+  uint16_t GlyphStart[NumGlyphs + 1];   // The runs of glyph i are Runs[GlyphStart[i]] up to Runs[GlyphStart[i + 1]]
+  uint8_t Runs[NumRuns];
+};
+
+constexpr void AppendRun(uint8_t* pRuns, size_t& numRuns, uint32_t length)
+{
+  while (length > 255)
+  {
+    if (pRuns)
+    {
+      pRuns[numRuns] = 255;
+      pRuns[numRuns + 1] = 0;
+    }
+    numRuns += 2;
+    length -= 255;
+  }
+
+  if (pRuns)
+  {
+    pRuns[numRuns] = uint8_t(length);
+  }
+  numRuns++;
+}
+
+// Encode the glyphs into pRuns and pGlyphStart, and return the number of runs. Both can be nullptr to only count the runs
+template <size_t NumBytes, size_t NumGlyphs>
+constexpr size_t EncodeFontRunsInto(const uint8_t (&bitmap)[NumBytes], const GFXglyph (&glyphs)[NumGlyphs], uint8_t* pRuns, uint16_t* pGlyphStart)
+{
+  size_t numRuns = 0;
+
+  for (size_t i = 0; i < NumGlyphs; i++)
+  {
+    if (pGlyphStart)
+    {
+      pGlyphStart[i] = uint16_t(numRuns);
+    }
+
+    const uint32_t numPixels = uint32_t(glyphs[i].width) * glyphs[i].height;
+    const uint8_t* pBitmap = bitmap + glyphs[i].bitmapOffset;
+    bool bSet = false;
+    uint32_t length = 0;
+
+    for (uint32_t pixel = 0; pixel < numPixels; pixel++)
+    {
+      if (((pBitmap[pixel / 8] & (0x80 >> (pixel % 8))) != 0) != bSet)
+      {
+        AppendRun(pRuns, numRuns, length);
+        bSet = !bSet;
+        length = 0;
+      }
+      length++;
+    }
+
+    if (bSet)
+    {
+      AppendRun(pRuns, numRuns, length);
+    }
+  }
+
+  if (pGlyphStart)
+  {
+    pGlyphStart[NumGlyphs] = uint16_t(numRuns);
+  }
+  return numRuns;
+}
+
+template <size_t NumBytes, size_t NumGlyphs>
+constexpr size_t CountFontRuns(const uint8_t (&bitmap)[NumBytes], const GFXglyph (&glyphs)[NumGlyphs])
+{
+  return EncodeFontRunsInto(bitmap, glyphs, nullptr, nullptr);
+}
+
+// NumRuns has to be CountFontRuns(bitmap, glyphs)
+template <size_t NumRuns, size_t NumBytes, size_t NumGlyphs>
+constexpr FontRuns<NumRuns, NumGlyphs> EncodeFontRuns(const uint8_t (&bitmap)[NumBytes], const GFXglyph (&glyphs)[NumGlyphs])
+{
+  FontRuns<NumRuns, NumGlyphs> runs {};
+  EncodeFontRunsInto(bitmap, glyphs, runs.Runs, runs.GlyphStart);
+  return runs;
+}
+
+// Set the same pixels as gfx->printf() would for character c of the font with the cursor at cursorX,cursorY and the given text size
+template <size_t NumRuns, size_t NumGlyphs>
+void DrawGlyphRuns(Arduino_GFX* pGfx, const GFXfont& font, const FontRuns<NumRuns, NumGlyphs>& runs, const char c, const int16_t cursorX,
+                   const int16_t cursorY, const uint8_t textSize, const uint16_t color)
+{
+  const uint16_t index = uint8_t(c) - font.first;
+  const GFXglyph& glyph = font.glyph[index];
+  const int16_t left = cursorX + glyph.xOffset * textSize;
+  int16_t y = cursorY + glyph.yOffset * textSize;
+  int16_t column = 0;
+  bool bSet = false;
+
+  pGfx->startWrite();
+  for (uint16_t i = runs.GlyphStart[index]; i < runs.GlyphStart[index + 1]; i++, bSet = !bSet)
+  {
+    int16_t length = runs.Runs[i];
+    while (length > 0)
+    {
+      // A run continues on the next row when it reaches the right edge of the glyph
+      const int16_t spanLength = min<int16_t>(length, glyph.width - column);
+      if (bSet)
+      {
+        pGfx->writeFillRect(left + column * textSize, y, spanLength * textSize, textSize, color);
+      }
+
+      length -= spanLength;
+      column += spanLength;
+      if (column == glyph.width)
+      {
+        column = 0;
+        y += textSize;
+      }
+    }
+  }
+  pGfx->endWrite();
+}
+
+#endif  // _HOST_GLYPH_RUNS
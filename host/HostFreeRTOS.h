@@ -0,0 +1,378 @@
+// Host-side stand-in for the FreeRTOS task, task notification, queue and semaphore functions used by this project. Each task runs on its own std::thread.
+//
+// A std::thread can't be stopped from the outside, so suspending and deleting a task is cooperative: the task is parked (or unwound)
+// the next time it calls delay() or blocks on a semaphore. The firmware's tasks call delay() every iteration, so this is enough.
+
+#ifndef _HOST_FREERTOS
+#define _HOST_FREERTOS
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef int32_t  BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdFALSE           0
+#define pdTRUE            1
+#define pdPASS            pdTRUE
+#define pdFAIL            pdFALSE
+#define portMAX_DELAY     TickType_t(0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) TickType_t(ms)
+
+namespace Host
+{
+  // Thrown inside a task when it has been deleted, so it unwinds back to the thread entry point
+  struct TaskDeleted {};
+
+  struct Task
+  {
+    std::thread Thread;
+    std::mutex Mutex;
+    std::condition_variable Changed;
+    bool bSuspendRequested = false;
+    bool bParked = false;
+    bool bDeleteRequested = false;
+    bool bFinished = false;
+    BaseType_t CoreID = 0;
+    uint32_t NotificationValue = 0;
+  };
+
+  inline Task*& CurrentTask()
+  {
+    thread_local Task* pCurrentTask = nullptr;
+    return pCurrentTask;
+  }
+
+  // CPU time consumed by tasks that have finished, per core. The main thread represents core 1 where setup() and loop() run
+  inline std::atomic<uint64_t>* FinishedTaskCpuMicros()
+  {
+    static std::atomic<uint64_t> cpuMicros[2] = { { 0 }, { 0 } };
+    return cpuMicros;
+  }
+
+  // Called by a task whenever it would block. Parks the task while it's suspended and unwinds it when it has been deleted
+  inline void TaskCheckpoint()
+  {
+    Task* pTask = CurrentTask();
+    if (pTask == nullptr)
+    {
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(pTask->Mutex);
+    while (pTask->bSuspendRequested && !pTask->bDeleteRequested)
+    {
+      pTask->bParked = true;
+      pTask->Changed.notify_all();
+      pTask->Changed.wait(lock);
+    }
+    pTask->bParked = false;
+
+    if (pTask->bDeleteRequested)
+    {
+      throw TaskDeleted();
+    }
+  }
+
+  // Sleep in small slices so a suspended or deleted task reacts quickly
+  inline void SleepMicros(uint64_t simulatedMicros)
+  {
+    const uint64_t sliceMicros = 2000;
+    uint64_t realMicros = uint64_t(simulatedMicros / TimeScale().load());
+
+    do
+    {
+      TaskCheckpoint();
+      uint64_t sleepMicros = min(realMicros, sliceMicros);
+      std::this_thread::sleep_for(std::chrono::microseconds(sleepMicros));
+      realMicros -= sleepMicros;
+    } while (realMicros > 0);
+
+    TaskCheckpoint();
+  }
+
+  // Keep the CPU busy for as long as simulatedMicros take, like polling for the end of an SPI transfer does
+  inline void BusyWaitMicros(uint64_t simulatedMicros)
+  {
+    const uint64_t endMicros = Host::RealMicros() + uint64_t(simulatedMicros / TimeScale().load());
+    while (Host::RealMicros() < endMicros)
+    {
+    }
+
+    TaskCheckpoint();
+  }
+
+  // Wait for a condition with a FreeRTOS style timeout in ticks (= milliseconds). Returns the final value of the condition
+  template <typename Condition>
+  bool WaitFor(std::unique_lock<std::mutex>& lock, std::condition_variable& changed, const TickType_t ticks, Condition condition)
+  {
+    const uint64_t sliceMicros = 2000;
+    const uint64_t endMicros = (ticks == portMAX_DELAY) ? UINT64_MAX : Host::RealMicros() + uint64_t(ticks * 1000 / TimeScale().load());
+
+    while (!condition())
+    {
+      const uint64_t nowMicros = Host::RealMicros();
+      if (nowMicros >= endMicros)
+      {
+        return false;
+      }
+
+      changed.wait_for(lock, std::chrono::microseconds(min(sliceMicros, endMicros - nowMicros)));
+
+      lock.unlock();
+      TaskCheckpoint();
+      lock.lock();
+    }
+
+    return true;
+  }
+}
+
+// --------------------------------------------------------
+// ******** Tasks *****************************************
+// --------------------------------------------------------
+
+typedef Host::Task* TaskHandle_t;
+
+inline BaseType_t xPortGetCoreID()
+{
+  Host::Task* pTask = Host::CurrentTask();
+  return (pTask == nullptr) ? 1 : pTask->CoreID;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, const uint32_t stackDepth, void* params, UBaseType_t priority,
+                                          TaskHandle_t* pCreatedTask, const BaseType_t coreID)
+{
+  Host::Task* pTask = new Host::Task();
+  pTask->CoreID = coreID;
+
+  // Hand out the handle before the task starts, just like FreeRTOS does when the new task has a lower priority
+  if (pCreatedTask)
+  {
+    *pCreatedTask = pTask;
+  }
+
+  pTask->Thread = std::thread([pTask, function, params]()
+  {
+    Host::CurrentTask() = pTask;
+
+    try
+    {
+      function(params);
+    }
+    catch (const Host::TaskDeleted&)
+    {
+    }
+
+    Host::FinishedTaskCpuMicros()[pTask->CoreID & 1] += Host::ThreadCpuMicros();
+
+    std::lock_guard<std::mutex> lock(pTask->Mutex);
+    pTask->bFinished = true;
+    pTask->Changed.notify_all();
+  });
+
+  return pdPASS;
+}
+
+inline void vTaskSuspend(TaskHandle_t task)
+{
+  if (task == nullptr || task == Host::CurrentTask())
+  {
+    task = Host::CurrentTask();
+    {
+      std::lock_guard<std::mutex> lock(task->Mutex);
+      task->bSuspendRequested = true;
+    }
+    Host::TaskCheckpoint();
+    return;
+  }
+
+  // Wait until the task has actually parked, so the caller can safely use whatever the task was using
+  std::unique_lock<std::mutex> lock(task->Mutex);
+  task->bSuspendRequested = true;
+  task->Changed.wait(lock, [task]() { return task->bParked || task->bFinished; });
+}
+
+inline void vTaskResume(TaskHandle_t task)
+{
+  std::lock_guard<std::mutex> lock(task->Mutex);
+  task->bSuspendRequested = false;
+  task->Changed.notify_all();
+}
+
+inline void vTaskDelete(TaskHandle_t task)
+{
+  if (task == nullptr || task == Host::CurrentTask())
+  {
+    // The thread can't join itself, so it's left to finish on its own
+    Host::CurrentTask()->Thread.detach();
+    throw Host::TaskDeleted();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(task->Mutex);
+    task->bDeleteRequested = true;
+    task->Changed.notify_all();
+  }
+
+  task->Thread.join();
+  delete task;
+}
+
+inline void vTaskDelay(const TickType_t ticks)
+{
+  Host::SleepMicros(uint64_t(ticks) * 1000);
+}
+
+// --------------------------------------------------------
+// ******** Task notifications ****************************
+// --------------------------------------------------------
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  std::lock_guard<std::mutex> lock(task->Mutex);
+  task->NotificationValue++;
+  task->Changed.notify_all();
+  return pdPASS;
+}
+
+inline uint32_t ulTaskNotifyTake(const BaseType_t bClearCountOnExit, const TickType_t ticks)
+{
+  Host::Task* pTask = Host::CurrentTask();
+  std::unique_lock<std::mutex> lock(pTask->Mutex);
+  Host::WaitFor(lock, pTask->Changed, ticks, [pTask]() { return pTask->NotificationValue > 0; });
+
+  const uint32_t value = pTask->NotificationValue;
+  if (value > 0)
+  {
+    pTask->NotificationValue = bClearCountOnExit ? 0 : value - 1;
+  }
+  return value;
+}
+
+// --------------------------------------------------------
+// ******** Queues ****************************************
+// --------------------------------------------------------
+
+struct HostQueue
+{
+  std::mutex Mutex;
+  std::condition_variable Changed;
+  std::deque<std::vector<uint8_t>> Items;
+  UBaseType_t Length = 1;
+  UBaseType_t ItemSize = 0;
+};
+
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize)
+{
+  QueueHandle_t queue = new HostQueue();
+  queue->Length = length;
+  queue->ItemSize = itemSize;
+  return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue)
+{
+  delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* pItem, const TickType_t ticks)
+{
+  std::unique_lock<std::mutex> lock(queue->Mutex);
+  if (!Host::WaitFor(lock, queue->Changed, ticks, [queue]() { return queue->Items.size() < queue->Length; }))
+  {
+    return pdFALSE;
+  }
+
+  const uint8_t* pBytes = (const uint8_t*)pItem;
+  queue->Items.emplace_back(pBytes, pBytes + queue->ItemSize);
+  queue->Changed.notify_all();
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* pItem, const TickType_t ticks)
+{
+  std::unique_lock<std::mutex> lock(queue->Mutex);
+  if (!Host::WaitFor(lock, queue->Changed, ticks, [queue]() { return !queue->Items.empty(); }))
+  {
+    return pdFALSE;
+  }
+
+  memcpy(pItem, queue->Items.front().data(), queue->ItemSize);
+  queue->Items.pop_front();
+  queue->Changed.notify_all();
+  return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(queue->Mutex);
+  return queue->Items.size();
+}
+
+// --------------------------------------------------------
+// ******** Semaphores ************************************
+// --------------------------------------------------------
+
+struct HostSemaphore
+{
+  std::mutex Mutex;
+  std::condition_variable Changed;
+  UBaseType_t Count = 0;
+  UBaseType_t MaxCount = 1;
+};
+
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return new HostSemaphore();
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateCounting(const UBaseType_t maxCount, const UBaseType_t initialCount)
+{
+  SemaphoreHandle_t semaphore = new HostSemaphore();
+  semaphore->MaxCount = maxCount;
+  semaphore->Count = initialCount;
+  return semaphore;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+  delete semaphore;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, const TickType_t ticks)
+{
+  std::unique_lock<std::mutex> lock(semaphore->Mutex);
+  if (!Host::WaitFor(lock, semaphore->Changed, ticks, [semaphore]() { return semaphore->Count > 0; }))
+  {
+    return pdFALSE;
+  }
+
+  semaphore->Count--;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  std::lock_guard<std::mutex> lock(semaphore->Mutex);
+  if (semaphore->Count >= semaphore->MaxCount)
+  {
+    return pdFALSE;
+  }
+
+  semaphore->Count++;
+  semaphore->Changed.notify_one();
+  return pdTRUE;
+}
+
+#endif  // _HOST_FREERTOS
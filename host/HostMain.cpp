@@ -0,0 +1,365 @@
+// Runs the firmware on a PC. The sketch is compiled unmodified against the stand-ins in this folder: setup() and loop() run on the main
+// thread (core 1), DisplayInfo() runs on its own thread (core 0), CAN frames come from a simulated bus and the display is an in-memory
+// RGB565 framebuffer. At the end, statistics about the CAN bus, the display bus and CPU time are printed.
+//
+// Usage: obd2_host [options]
+//    --time-scale <factor>   Run the simulated device faster than real time, e.g. 4 (default 1)
+//    --trace <file>          Replay a recorded candump or ASC trace instead of the synthetic drive
+//    --speed <factor|max>    Replay speed relative to the recording (default: same as the time scale)
+//    --save-screen <file>    Save the final screen as a PPM image
+//    --save-trace <file>     Save the frames that would be replayed as a candump log file and exit
+//    --no-background         Only send the CAN frames the firmware decodes in the synthetic drive
+//    --bench-collect         Measure the throughput of CollectCarData() instead of running the firmware
+//    --bench-dispatch        Compare finding CanIDs[] entries with a linear scan and with the dispatch table
+//    --filter-report         Show the CAN acceptance filter and the fraction of the trace that passes it
+//    --stress-car-data       Check that the display core never sees half updated car data
+//    --bench-arc             Compare redrawing the whole shift indicator every frame with drawing only what changed
+//    --bench-gear            Compare printing the gear with gfx->printf() against the sprite cache, the glyph runs and DrawGlyph()
+//    --bench-dma             Measure how much rendering overlaps with sending pixels over the DMA SPI bus
+//    --bench-readout         Compare redrawing the whole RPM readout against only drawing the characters that changed
+//    --bench-history         Compare writing one column per sample of the RPM history strip against redrawing it
+//    --bench-canvas          Compare drawing straight to the display, into the offscreen and tile canvases and in scanline bands
+//    --check-gear-font       Check that the subset font mirrored at compile time matches what MirrorText() produced at runtime
+//    --generate-arc-spans <file>  Generate the scanline spans of the shift indicator ring (ArcSpans.h)
+//    --generate-gear-font <file>  Generate the font with only the gear characters (GearFont.h)
+//    --generate-digit-font <file> Generate the scaled down font numbers are shown with (DigitFont.h)
+
+#include <Arduino.h>
+#include "../OBD2_Display_for_FordMustang_ESP32-S3.ino"
+#include "CanTraceReplay.h"
+#include "Benchmarks.h"
+#include "ArcSpanGenerator.h"
+#include "FontSubsetGenerator.h"
+
+struct HostOptions
+{
+  double TimeScale = 1.0;
+  double Speed = -1.0;      // Negative means "same as the time scale"
+  const char* TraceFilename = nullptr;
+  const char* SaveScreenFilename = nullptr;
+  const char* SaveTraceFilename = nullptr;
+  bool bBackgroundTraffic = true;
+  bool bBenchmarkCollect = false;
+  bool bBenchmarkDispatch = false;
+  bool bFilterReport = false;
+  bool bStressCarData = false;
+  bool bBenchmarkArc = false;
+  bool bBenchmarkDma = false;
+  bool bBenchmarkCanvas = false;
+  bool bBenchmarkReadout = false;
+  bool bBenchmarkHistory = false;
+  bool bBenchmarkGear = false;
+  bool bCheckGearFont = false;
+  const char* ArcSpansFilename = nullptr;
+  const char* GearFontFilename = nullptr;
+  const char* DigitFontFilename = nullptr;
+};
+
+void PrintUsage()
+{
+  printf("Usage: obd2_host [--time-scale <factor>] [--trace <file>] [--speed <factor|max>] [--save-screen <file.ppm>]\n"
+         "                 [--save-trace <file.log>] [--no-background] [--bench-collect] [--bench-dispatch]\n"
+         "                 [--filter-report] [--stress-car-data] [--bench-arc]\n"
+         "                 [--bench-dma] [--bench-canvas] [--bench-readout] [--bench-history] [--bench-gear]\n"
+         "                 [--check-gear-font] [--generate-arc-spans <file.h>] [--generate-gear-font <file.h>]\n"
+         "                 [--generate-digit-font <file.h>]\n");
+}
+
+bool ParseOptions(int argc, char** argv, HostOptions& options)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    const bool bHasValue = (i + 1 < argc);
+
+    if (strcmp(argv[i], "--time-scale") == 0 && bHasValue)
+    {
+      options.TimeScale = atof(argv[++i]);
+    }
+    else if (strcmp(argv[i], "--trace") == 0 && bHasValue)
+    {
+      options.TraceFilename = argv[++i];
+    }
+    else if (strcmp(argv[i], "--speed") == 0 && bHasValue)
+    {
+      i++;
+      options.Speed = (strcmp(argv[i], "max") == 0) ? Host::ReplayAsFastAsPossible : atof(argv[i]);
+    }
+    else if (strcmp(argv[i], "--save-screen") == 0 && bHasValue)
+    {
+      options.SaveScreenFilename = argv[++i];
+    }
+    else if (strcmp(argv[i], "--save-trace") == 0 && bHasValue)
+    {
+      options.SaveTraceFilename = argv[++i];
+    }
+    else if (strcmp(argv[i], "--no-background") == 0)
+    {
+      options.bBackgroundTraffic = false;
+    }
+    else if (strcmp(argv[i], "--bench-collect") == 0)
+    {
+      options.bBenchmarkCollect = true;
+    }
+    else if (strcmp(argv[i], "--bench-dispatch") == 0)
+    {
+      options.bBenchmarkDispatch = true;
+    }
+    else if (strcmp(argv[i], "--filter-report") == 0)
+    {
+      options.bFilterReport = true;
+    }
+    else if (strcmp(argv[i], "--stress-car-data") == 0)
+    {
+      options.bStressCarData = true;
+    }
+    else if (strcmp(argv[i], "--bench-arc") == 0)
+    {
+      options.bBenchmarkArc = true;
+    }
+    else if (strcmp(argv[i], "--bench-dma") == 0)
+    {
+      options.bBenchmarkDma = true;
+    }
+    else if (strcmp(argv[i], "--bench-canvas") == 0)
+    {
+      options.bBenchmarkCanvas = true;
+    }
+    else if (strcmp(argv[i], "--bench-readout") == 0)
+    {
+      options.bBenchmarkReadout = true;
+    }
+    else if (strcmp(argv[i], "--bench-history") == 0)
+    {
+      options.bBenchmarkHistory = true;
+    }
+    else if (strcmp(argv[i], "--bench-gear") == 0)
+    {
+      options.bBenchmarkGear = true;
+    }
+    else if (strcmp(argv[i], "--check-gear-font") == 0)
+    {
+      options.bCheckGearFont = true;
+    }
+    else if (strcmp(argv[i], "--generate-arc-spans") == 0 && bHasValue)
+    {
+      options.ArcSpansFilename = argv[++i];
+    }
+    else if (strcmp(argv[i], "--generate-gear-font") == 0 && bHasValue)
+    {
+      options.GearFontFilename = argv[++i];
+    }
+    else if (strcmp(argv[i], "--generate-digit-font") == 0 && bHasValue)
+    {
+      options.DigitFontFilename = argv[++i];
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void PrintReport(const uint64_t loopCpuMicros, const unsigned long runMillis, const Host::ReplayStats& replay)
+{
+  const Host::CanBusStats can = ESP32Can.HostStats();
+  printf("\nCAN bus\n");
+  printf("  Frames replayed    %10llu (%.0f frames/s)\n", (unsigned long long)replay.FramesReplayed, replay.FramesPerSecond());
+  printf("  Frames on bus      %10llu\n", (unsigned long long)can.FramesOnBus);
+  printf("  Frames filtered    %10llu\n", (unsigned long long)can.FramesFiltered);
+  printf("  Frames queued      %10llu\n", (unsigned long long)can.FramesQueued);
+  printf("  Frames dropped     %10llu\n", (unsigned long long)can.FramesDropped);
+  printf("  Frames read        %10llu\n", (unsigned long long)can.FramesRead);
+  printf("  Max RX queue depth %10u\n", can.MaxQueueDepth);
+
+  const CollectCarDataStats& collect = g_CollectCarDataStats;
+  printf("\nCollectCarData()\n");
+  printf("  Batches            %10u\n", collect.Batches);
+  printf("  Frames per batch   %10.2f (max %u)\n", collect.Batches ? double(collect.Frames) / collect.Batches : 0.0, collect.MaxFramesPerBatch);
+  printf("  Publishes          %10u (%.1f/s)\n", collect.Publishes, collect.Publishes * 1000.0 / max(runMillis, 1ul));
+
+  Arduino_TFT* pPanel = Host::Panel();
+  const Host::DisplayBusStats& display = pPanel->HostBus()->HostStats();
+  printf("\nDisplay bus\n");
+  printf("  Address windows    %10llu\n", (unsigned long long)display.AddressWindows);
+  printf("  Pixels written     %10llu\n", (unsigned long long)display.Pixels());
+  printf("  Bytes transferred  %10llu\n", (unsigned long long)display.TotalBytes());
+  printf("  SPI busy time      %10.1f ms\n", pPanel->HostBus()->HostBusMicros() / 1000.0);
+
+  const FramePacerStats& frames = framePacer.Stats();
+  printf("\nDisplay frames\n");
+  printf("  Frames             %10u (%.1f/s, target %u/s)\n", frames.Frames, frames.FramesPerSecond(), TargetFramesPerSecond);
+  printf("  Busy               %10.1f %%\n", frames.Load() * 100.0f);
+  printf("  Max frame time     %10u us\n", frames.MaxFrameMicros);
+  printf("  Overruns           %10u (%u slots skipped)\n", frames.Overruns, frames.SkippedSlots);
+
+  FrameTimingWindow window;
+  if (frameTiming.ReadCompletedWindow(window))
+  {
+    printf("\nFrame timing, last %u frames  %10s %10s %10s %10s\n", window.Stages[uint32_t(FrameStage::Frame)].Count, "Min us", "Avg us", "P99 us", "Max us");
+    for (uint32_t i = 0; i < NumFrameStages; i++)
+    {
+      const StageHistogram& stage = window.Stages[i];
+      printf("  %-27s %10.1f %10.1f %10.1f %10.1f\n", FrameStageNames[i], stage.MinNanos / 1000.0, stage.AverageNanos() / 1000.0,
+             stage.PercentileNanos(0.99f) / 1000.0, stage.MaxNanos / 1000.0);
+    }
+  }
+
+  printf("\nCPU time\n");
+  printf("  Core 1 (loop)      %10.1f ms\n", loopCpuMicros / 1000.0);
+  printf("  Core 0 (display)   %10.1f ms\n", Host::FinishedTaskCpuMicros()[0] / 1000.0);
+
+  printf("\nScreen hash          0x%08x\n", pPanel->HostGramHash());
+}
+
+// Run the firmware while the trace is replayed, and keep it running a little while after the last frame so the display shows the final state
+int RunFirmware(const std::vector<Host::TimedCanFrame>& frames, const HostOptions& options)
+{
+  const double speed = (options.Speed < 0.0) ? options.TimeScale : options.Speed;
+  const unsigned long traceMillis = Host::CanTraceDurationMicros(frames) / 1000;
+
+  Host::CanTraceReplay replay;
+  replay.Start(frames, speed);
+
+  const unsigned long runStartMillis = millis();
+  try
+  {
+    setup();
+
+    const unsigned long startMillis = millis();
+    while (!replay.IsDone() || millis() - startMillis < traceMillis + 500)
+    {
+      loop();
+    }
+  }
+  catch (const Host::Restart&)
+  {
+    printf("Firmware restarted the device\n");
+  }
+
+  const uint64_t loopCpuMicros = Host::ThreadCpuMicros();
+  const unsigned long runMillis = millis() - runStartMillis;
+
+  ESP32Can.end();
+  replay.Stop();
+
+  if (g_TaskDisplayInfo)
+  {
+    vTaskDelete(g_TaskDisplayInfo);
+    g_TaskDisplayInfo = nullptr;
+  }
+
+  PrintReport(loopCpuMicros, runMillis, replay.Stats());
+
+  if (options.SaveScreenFilename && !Host::Panel()->HostSavePPM(options.SaveScreenFilename))
+  {
+    printf("Failed to save %s\n", options.SaveScreenFilename);
+    return 1;
+  }
+
+  return 0;
+}
+
+int main(int argc, char** argv)
+{
+  HostOptions options;
+  if (!ParseOptions(argc, argv, options))
+  {
+    PrintUsage();
+    return 1;
+  }
+
+  Host::SetTimeScale(options.TimeScale);
+
+  if (options.ArcSpansFilename)
+  {
+    return Host::GenerateArcSpans(options.ArcSpansFilename) ? 0 : 1;
+  }
+
+  if (options.GearFontFilename)
+  {
+    return Host::GenerateGearFont(options.GearFontFilename) ? 0 : 1;
+  }
+
+  if (options.DigitFontFilename)
+  {
+    return Host::GenerateDigitFont(options.DigitFontFilename) ? 0 : 1;
+  }
+
+  if (options.bCheckGearFont)
+  {
+    return Host::CheckGearFont() ? 0 : 1;
+  }
+
+  if (options.bBenchmarkDma)
+  {
+    return Host::BenchmarkDisplayTransfer() ? 0 : 1;
+  }
+
+  if (options.bBenchmarkGear)
+  {
+    return Host::BenchmarkGearText() ? 0 : 1;
+  }
+
+  if (options.bStressCarData)
+  {
+    return Host::StressSharedCarData() ? 0 : 1;
+  }
+
+  std::vector<Host::TimedCanFrame> frames;
+  if (options.TraceFilename)
+  {
+    if (!Host::LoadCanTrace(options.TraceFilename, frames))
+    {
+      printf("Failed to load %s\n", options.TraceFilename);
+      return 1;
+    }
+  }
+  else
+  {
+    frames = Host::GenerateSyntheticDrive(options.bBackgroundTraffic);
+  }
+
+  if (options.SaveTraceFilename)
+  {
+    return Host::SaveCanTrace(options.SaveTraceFilename, frames) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkCollect)
+  {
+    return Host::BenchmarkCollectCarData(frames, max(options.Speed, 0.0)) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkDispatch)
+  {
+    return Host::BenchmarkCanIDDispatch(frames) ? 0 : 1;
+  }
+
+  if (options.bFilterReport)
+  {
+    return Host::ReportAcceptanceFilter(frames) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkArc)
+  {
+    return Host::BenchmarkShiftIndicator(frames) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkCanvas)
+  {
+    return Host::BenchmarkOffscreenCanvas(frames) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkReadout)
+  {
+    return Host::BenchmarkNumericReadout(frames) ? 0 : 1;
+  }
+
+  if (options.bBenchmarkHistory)
+  {
+    return Host::BenchmarkRPMHistory(frames) ? 0 : 1;
+  }
+
+  return RunFirmware(frames, options);
+}
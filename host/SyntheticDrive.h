@@ -0,0 +1,164 @@
+// A short, made up drive that produces the same broadcast CAN frames the 2016 Ford Mustang Ecoboost puts on the HS-CAN bus: idle in Park,
+// pull away in Drive and go up through the gears, cruise, stop and reverse. Frames for modules we don't decode are mixed in at realistic
+// rates, so the firmware has to deal with a busy bus just like in the car.
+
+#ifndef _HOST_SYNTHETIC_DRIVE
+#define _HOST_SYNTHETIC_DRIVE
+
+#include <vector>
+
+namespace Host
+{
+  struct TimedCanFrame
+  {
+    uint64_t TimeMicros;    // Time the frame was seen on the bus, relative to the start of the recording
+    CanFrame Frame;
+  };
+
+  // A point on the drive. RPM is interpolated between key frames, gear and gearbox mode change at the key frame
+  struct DriveKeyFrame
+  {
+    float Seconds;
+    int32_t EngineRPM;
+    int32_t Gear;         // 0 = Neutral, -1 = Reverse
+    int32_t GearboxMode;
+  };
+
+  const DriveKeyFrame SyntheticDriveKeyFrames[] = { {  0.0f,  750,  0, GearboxMode::P },
+                                                    {  1.0f,  750,  0, GearboxMode::P },
+                                                    {  1.2f,  800,  1, GearboxMode::D },
+                                                    {  3.0f, 5000,  1, GearboxMode::D },
+                                                    {  3.3f, 3100,  2, GearboxMode::D },
+                                                    {  5.0f, 4800,  2, GearboxMode::D },
+                                                    {  5.3f, 3300,  3, GearboxMode::D },
+                                                    {  7.0f, 4200,  3, GearboxMode::D },
+                                                    {  7.3f, 2800,  4, GearboxMode::D },
+                                                    {  8.5f, 2500,  5, GearboxMode::D },
+                                                    {  9.5f, 2000,  6, GearboxMode::D },
+                                                    { 11.0f, 2000,  6, GearboxMode::D },
+                                                    { 12.0f, 1200,  3, GearboxMode::D },
+                                                    { 13.0f,  800,  1, GearboxMode::D },
+                                                    { 13.5f,  800,  0, GearboxMode::N },
+                                                    { 14.0f,  900, -1, GearboxMode::R },
+                                                    { 15.5f,  850, -1, GearboxMode::R },
+                                                    { 16.0f,  750,  0, GearboxMode::P },
+                                                    { 17.0f,  750,  0, GearboxMode::P } };
+
+  // Broadcast frames we don't decode: CAN ID and period in milliseconds
+  struct BackgroundTraffic
+  {
+    uint32_t ID;
+    uint32_t PeriodMillis;
+  };
+
+  const BackgroundTraffic SyntheticBackgroundTraffic[] = { { 0x076, 10 }, { 0x077, 10 }, { 0x079, 10 }, { 0x07D, 10 }, { 0x083, 10 },
+                                                           { 0x091, 10 }, { 0x092, 10 }, { 0x167, 10 }, { 0x200, 10 }, { 0x202, 10 },
+                                                           { 0x213, 10 }, { 0x216, 20 }, { 0x217, 20 }, { 0x221, 20 }, { 0x3B3, 100 },
+                                                           { 0x3C3, 100 }, { 0x415, 20 }, { 0x420, 100 }, { 0x428, 100 }, { 0x430, 100 },
+                                                           { 0x4B0, 50 }, { 0x156, 20 }, { 0x178, 20 }, { 0x179, 20 }, { 0x17E, 50 } };
+
+  inline CanFrame MakeCanFrame(const uint32_t id, const uint8_t data[8])
+  {
+    CanFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.identifier = id;
+    frame.extd = (id > 0x7FF);
+    frame.data_length_code = 8;
+    memcpy(frame.data, data, 8);
+    return frame;
+  }
+
+  // Encode car state the way the firmware's OBD2Calculations.h decodes it
+  inline CanFrame MakeEngineRPMFrame(const int32_t engineRPM)
+  {
+    const uint32_t value = max(engineRPM, 0) / 2;
+    const uint8_t data[8] = { 0, 0, 0, uint8_t(value >> 8), uint8_t(value & 0xFF), 0, 0, 0 };
+    return MakeCanFrame(0x204, data);
+  }
+
+  inline CanFrame MakeCurrentGearFrame(const int32_t gear)
+  {
+    const uint8_t data[8] = { uint8_t((gear > 0) ? gear * 16 : 0), uint8_t((gear < 0) ? 2 : (gear == 0) ? 4 : 0), 0, 0, 0, 0, 0, 0 };
+    return MakeCanFrame(0x230, data);
+  }
+
+  inline CanFrame MakeGearboxModeFrame(const int32_t gearboxMode)
+  {
+    const uint8_t data[8] = { 0, uint8_t(gearboxMode), 0, 0, 0, 0, 0, 0 };
+    return MakeCanFrame(0x171, data);
+  }
+
+  inline DriveKeyFrame SampleDrive(const DriveKeyFrame* pKeyFrames, const size_t numKeyFrames, const float seconds)
+  {
+    for (size_t i = 1; i < numKeyFrames; i++)
+    {
+      if (seconds < pKeyFrames[i].Seconds)
+      {
+        const DriveKeyFrame& a = pKeyFrames[i - 1];
+        const DriveKeyFrame& b = pKeyFrames[i];
+        const float t = (seconds - a.Seconds) / (b.Seconds - a.Seconds);
+        return { seconds, int32_t(a.EngineRPM + t * (b.EngineRPM - a.EngineRPM)), a.Gear, a.GearboxMode };
+      }
+    }
+
+    return pKeyFrames[numKeyFrames - 1];
+  }
+
+  // Generate all frames of the synthetic drive, ordered by time. The payload of frames we don't decode is pseudo random, but the same every run
+  inline std::vector<TimedCanFrame> GenerateSyntheticDrive(const bool bBackgroundTraffic = true)
+  {
+    const size_t numKeyFrames = sizeof(SyntheticDriveKeyFrames) / sizeof(SyntheticDriveKeyFrames[0]);
+    const uint64_t durationMicros = uint64_t(SyntheticDriveKeyFrames[numKeyFrames - 1].Seconds * 1000000);
+    uint32_t random = 0x12345678;
+
+    std::vector<TimedCanFrame> frames;
+
+    for (uint64_t timeMillis = 0; timeMillis * 1000 < durationMicros; timeMillis++)
+    {
+      const DriveKeyFrame state = SampleDrive(SyntheticDriveKeyFrames, numKeyFrames, timeMillis / 1000.0f);
+      const uint64_t timeMicros = timeMillis * 1000;
+
+      // Spread frames over the millisecond like the bus arbitration would
+      uint64_t offsetMicros = 0;
+      auto addFrame = [&](const CanFrame& frame)
+      {
+        frames.push_back({ timeMicros + offsetMicros, frame });
+        offsetMicros += 7;
+      };
+
+      if (timeMillis % 10 == 0)
+      {
+        addFrame(MakeEngineRPMFrame(state.EngineRPM));
+      }
+      if (timeMillis % 20 == 5)
+      {
+        addFrame(MakeCurrentGearFrame(state.Gear));
+      }
+      if (timeMillis % 50 == 15)
+      {
+        addFrame(MakeGearboxModeFrame(state.GearboxMode));
+      }
+
+      if (bBackgroundTraffic)
+      {
+        for (const BackgroundTraffic& traffic : SyntheticBackgroundTraffic)
+        {
+          if (timeMillis % traffic.PeriodMillis == traffic.ID % traffic.PeriodMillis)
+          {
+            uint8_t data[8];
+            for (int i = 0; i < 8; i++)
+            {
+              random = random * 1664525u + 1013904223u;
+              data[i] = random >> 24;
+            }
+            addFrame(MakeCanFrame(traffic.ID, data));
+          }
+        }
+      }
+    }
+
+    return frames;
+  }
+}
+
+#endif  // _HOST_SYNTHETIC_DRIVE